@@ -41,6 +41,8 @@ namespace fheroes2
             return false;
         }
 
+        _files.reserve( count );
+
         ROStreamBuf fileEntries = _stream.getStreamBuf( count * fileRecordSize );
         const size_t nameEntriesSize = _maxFilenameSize * count;
         _stream.seek( size - nameEntriesSize );
@@ -85,6 +87,18 @@ namespace fheroes2
         return {};
     }
 
+    bool AGGFile::exists( const std::string & fileName ) const
+    {
+        const auto it = _files.find( fileName );
+
+        return it != _files.end() && it->second.first > 0;
+    }
+
+    size_t AGGFile::FilenameHash::operator()( const std::string & name ) const
+    {
+        return calculateAggFilenameHash( name );
+    }
+
     uint32_t calculateAggFilenameHash( const std::string_view str )
     {
         uint32_t hash = 0;
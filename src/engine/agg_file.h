@@ -22,10 +22,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -44,11 +43,20 @@ namespace fheroes2
         bool open( const std::string & fileName );
         std::vector<uint8_t> read( const std::string & fileName );
 
+        // Returns true if a non-empty file with the given name is present in this AGG file, without reading its contents.
+        bool exists( const std::string & fileName ) const;
+
     private:
+        // The AGG file already stores the hash of each file name, it is quite good for the lookup as well
+        struct FilenameHash
+        {
+            size_t operator()( const std::string & name ) const;
+        };
+
         static const size_t _maxFilenameSize = 15; // 8.3 ASCIIZ file name + 2-bytes padding
 
         StreamFile _stream;
-        std::map<std::string, std::pair<uint32_t, uint32_t>, std::less<>> _files;
+        std::unordered_map<std::string, std::pair<uint32_t, uint32_t>, FilenameHash> _files;
     };
 
     struct ICNHeader
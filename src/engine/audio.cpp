@@ -188,6 +188,16 @@ namespace
             }
         }
 
+        // Returns true if the given audio data is used by any of the samples that have not been freed yet
+        bool isSampleDataInUse( const Uint8 * data ) const
+        {
+            return std::any_of( _channelSamples.begin(), _channelSamples.end(), [data]( const auto & item ) {
+                const auto & [first, second] = item.second;
+
+                return ( first != nullptr && first->abuf == data ) || ( second != nullptr && second->abuf == data );
+            } );
+        }
+
     private:
         std::map<int, std::pair<Mix_Chunk *, Mix_Chunk *>> _channelSamples;
 
@@ -198,6 +208,163 @@ namespace
 
     SoundSampleManager soundSampleManager;
 
+    std::unique_ptr<Mix_Chunk, void ( * )( Mix_Chunk * )> loadChunk( const uint8_t * ptr, const uint32_t size )
+    {
+        const std::unique_ptr<SDL_RWops, void ( * )( SDL_RWops * )> rwops( SDL_RWFromConstMem( ptr, static_cast<int>( size ) ), SDL_FreeRW );
+        if ( !rwops ) {
+            ERROR_LOG( "Failed to create an audio chunk from memory. The error: " << SDL_GetError() )
+            return { nullptr, Mix_FreeChunk };
+        }
+
+        std::unique_ptr<Mix_Chunk, void ( * )( Mix_Chunk * )> chunk( Mix_LoadWAV_RW( rwops.get(), 0 ), Mix_FreeChunk );
+        if ( !chunk ) {
+            ERROR_LOG( "Failed to create an audio chunk from memory. The error: " << Mix_GetError() )
+        }
+
+        return chunk;
+    }
+
+    // Decoding of a sound (including its conversion to the output audio format) is quite expensive, so decoded sounds are
+    // cached. Each played sample is created on top of the cached audio data without copying it. The total size of the
+    // cached audio data is limited, the least recently used sounds are evicted from the cache first.
+    class SoundChunkCache
+    {
+    public:
+        SoundChunkCache() = default;
+        SoundChunkCache( const SoundChunkCache & ) = delete;
+
+        ~SoundChunkCache()
+        {
+            // Make sure that all cached sounds have been eventually freed
+            assert( _chunks.empty() );
+        }
+
+        SoundChunkCache & operator=( const SoundChunkCache & ) = delete;
+
+        // Returns the decoded sound with the given UID, decoding it from the memory buffer if it is not cached yet.
+        // Returns nullptr in case of failure.
+        Mix_Chunk * getChunk( const uint64_t soundUID, const uint8_t * ptr, const uint32_t size )
+        {
+            ++_accessCounter;
+
+            if ( const auto iter = _chunks.find( soundUID ); iter != _chunks.end() ) {
+                iter->second.lastAccess = _accessCounter;
+
+                return iter->second.chunk.get();
+            }
+
+            std::unique_ptr<Mix_Chunk, void ( * )( Mix_Chunk * )> chunk = loadChunk( ptr, size );
+            if ( !chunk ) {
+                return nullptr;
+            }
+
+            _totalSize += chunk->alen;
+
+            Mix_Chunk * result = chunk.get();
+
+            const auto res = _chunks.try_emplace( soundUID, CachedChunk{ std::move( chunk ), _accessCounter } );
+            if ( !res.second ) {
+                assert( 0 );
+            }
+
+            evictChunks( soundUID );
+
+            return result;
+        }
+
+        void clear()
+        {
+            _chunks.clear();
+            _totalSize = 0;
+        }
+
+    private:
+        struct CachedChunk
+        {
+            std::unique_ptr<Mix_Chunk, void ( * )( Mix_Chunk * )> chunk;
+            uint64_t lastAccess{ 0 };
+        };
+
+        // The maximum total size of the cached audio data, in bytes
+        static constexpr size_t maxTotalSize{ 32 * 1024 * 1024 };
+
+        void evictChunks( const uint64_t protectedSoundUID )
+        {
+            while ( _totalSize > maxTotalSize ) {
+                auto lruIter = _chunks.end();
+
+                for ( auto iter = _chunks.begin(); iter != _chunks.end(); ++iter ) {
+                    // Audio data of sounds that are being played at the moment should not be freed
+                    if ( iter->first == protectedSoundUID || soundSampleManager.isSampleDataInUse( iter->second.chunk->abuf ) ) {
+                        continue;
+                    }
+
+                    if ( lruIter == _chunks.end() || iter->second.lastAccess < lruIter->second.lastAccess ) {
+                        lruIter = iter;
+                    }
+                }
+
+                if ( lruIter == _chunks.end() ) {
+                    // All cached sounds are in use, the cache will be shrunk later
+                    return;
+                }
+
+                assert( _totalSize >= lruIter->second.chunk->alen );
+
+                _totalSize -= lruIter->second.chunk->alen;
+                _chunks.erase( lruIter );
+            }
+        }
+
+        std::map<uint64_t, CachedChunk> _chunks;
+        size_t _totalSize{ 0 };
+        uint64_t _accessCounter{ 0 };
+    };
+
+    SoundChunkCache soundChunkCache;
+
+    // This function should be called with the audioMutex acquired
+    int playChunk( std::unique_ptr<Mix_Chunk, void ( * )( Mix_Chunk * )> sample, const bool loop, const std::optional<std::pair<int16_t, uint8_t>> position )
+    {
+        // SDL itself maintains all internal channel bookkeeping, so when using the "first free channel"
+        // for playback, it is not known in advance which channel will be used. If additional channel
+        // setup is needed, then, to avoid arbitrary volume fluctuations, we will temporarily mute the
+        // audio chunk itself until we can properly adjust the channel parameters.
+        const int chunkVolume = position ? Mix_VolumeChunk( sample.get(), 0 ) : 0;
+        if ( chunkVolume < 0 ) {
+            ERROR_LOG( "Failed to mute the audio chunk. The error: " << Mix_GetError() )
+            return -1;
+        }
+
+        const int channel = Mix_PlayChannel( -1, sample.get(), loop ? -1 : 0 );
+        if ( channel < 0 ) {
+            ERROR_LOG( "Failed to play the audio chunk. The error: " << Mix_GetError() )
+            return channel;
+        }
+
+        if ( position ) {
+            // Immediately pause the channel so as not to continue playing while it is being set up
+            Mix_Pause( channel );
+
+            Mixer::setPosition( channel, position->first, position->second );
+
+            // When restoring the volume of an audio chunk, the only correct result of the call is zero,
+            // because this is exactly what the volume of the muted chunk should be
+            if ( Mix_VolumeChunk( sample.get(), chunkVolume ) != 0 ) {
+                ERROR_LOG( "Failed to restore the volume of the audio chunk for channel " << channel << ". The error: " << Mix_GetError() )
+            }
+
+            // Resume the channel as soon as all its parameters are settled
+            Mix_Resume( channel );
+        }
+
+        // There can be a maximum of two items in the sample queue for a channel:
+        // the previous sample (if it hasn't been freed yet) and the current one
+        soundSampleManager.channelStarted( channel, sample.release() );
+
+        return channel;
+    }
+
     // This is the callback function set by Mix_ChannelFinished(). As a rule, it is called from
     // a SDL_Mixer internal thread. Calls of any SDL_Mixer functions are not allowed in callbacks.
     void SDLCALL channelFinished( const int channelId )
@@ -729,6 +896,7 @@ void Audio::Quit()
         Mix_HookMusicFinished( nullptr );
 
         soundSampleManager.clearFinishedSamples();
+        soundChunkCache.clear();
 
         musicTrackManager.clearFinishedMusic();
         musicTrackManager.clearMusicDB();
@@ -826,7 +994,27 @@ int Mixer::getChannelCount()
     return mixerChannelCount;
 }
 
-int Mixer::Play( const uint8_t * ptr, const uint32_t size, const bool loop, const std::optional<std::pair<int16_t, uint8_t>> position /* = {} */ )
+void Mixer::preload( const uint64_t soundUID, const uint8_t * ptr, const uint32_t size )
+{
+    if ( ptr == nullptr || size == 0 ) {
+        // You are trying to preload an empty sound. Check your logic!
+        assert( 0 );
+        return;
+    }
+
+    const std::scoped_lock<std::recursive_mutex> lock( audioMutex );
+
+    if ( !isInitialized ) {
+        return;
+    }
+
+    soundSampleManager.clearFinishedSamples();
+
+    soundChunkCache.getChunk( soundUID, ptr, size );
+}
+
+int Mixer::Play( const uint64_t soundUID, const uint8_t * ptr, const uint32_t size, const bool loop,
+                 const std::optional<std::pair<int16_t, uint8_t>> position /* = {} */ )
 {
     if ( ptr == nullptr || size == 0 ) {
         // You are trying to play an empty sound. Check your logic!
@@ -842,55 +1030,44 @@ int Mixer::Play( const uint8_t * ptr, const uint32_t size, const bool loop, cons
 
     soundSampleManager.clearFinishedSamples();
 
-    const std::unique_ptr<SDL_RWops, void ( * )( SDL_RWops * )> rwops( SDL_RWFromConstMem( ptr, static_cast<int>( size ) ), SDL_FreeRW );
-    if ( !rwops ) {
-        ERROR_LOG( "Failed to create an audio chunk from memory. The error: " << SDL_GetError() )
+    Mix_Chunk * cachedChunk = soundChunkCache.getChunk( soundUID, ptr, size );
+    if ( cachedChunk == nullptr ) {
         return -1;
     }
 
-    std::unique_ptr<Mix_Chunk, void ( * )( Mix_Chunk * )> sample( Mix_LoadWAV_RW( rwops.get(), 0 ), Mix_FreeChunk );
+    // Each played sample has its own volume, so it is created on top of the cached audio data. This audio data is not copied
+    // and will not be freed along with the sample.
+    std::unique_ptr<Mix_Chunk, void ( * )( Mix_Chunk * )> sample( Mix_QuickLoad_RAW( cachedChunk->abuf, cachedChunk->alen ), Mix_FreeChunk );
     if ( !sample ) {
-        ERROR_LOG( "Failed to create an audio chunk from memory. The error: " << Mix_GetError() )
+        ERROR_LOG( "Failed to create an audio chunk from the cached audio data. The error: " << Mix_GetError() )
         return -1;
     }
 
-    // SDL itself maintains all internal channel bookkeeping, so when using the "first free channel"
-    // for playback, it is not known in advance which channel will be used. If additional channel
-    // setup is needed, then, to avoid arbitrary volume fluctuations, we will temporarily mute the
-    // audio chunk itself until we can properly adjust the channel parameters.
-    const int chunkVolume = position ? Mix_VolumeChunk( sample.get(), 0 ) : 0;
-    if ( chunkVolume < 0 ) {
-        ERROR_LOG( "Failed to mute the audio chunk. The error: " << Mix_GetError() )
-        return -1;
-    }
+    return playChunk( std::move( sample ), loop, position );
+}
 
-    const int channel = Mix_PlayChannel( -1, sample.get(), loop ? -1 : 0 );
-    if ( channel < 0 ) {
-        ERROR_LOG( "Failed to play the audio chunk. The error: " << Mix_GetError() )
-        return channel;
+int Mixer::Play( const uint8_t * ptr, const uint32_t size, const bool loop )
+{
+    if ( ptr == nullptr || size == 0 ) {
+        // You are trying to play an empty sound. Check your logic!
+        assert( 0 );
+        return -1;
     }
 
-    if ( position ) {
-        // Immediately pause the channel so as not to continue playing while it is being set up
-        Mix_Pause( channel );
+    const std::scoped_lock<std::recursive_mutex> lock( audioMutex );
 
-        setPosition( channel, position->first, position->second );
+    if ( !isInitialized ) {
+        return -1;
+    }
 
-        // When restoring the volume of an audio chunk, the only correct result of the call is zero,
-        // because this is exactly what the volume of the muted chunk should be
-        if ( Mix_VolumeChunk( sample.get(), chunkVolume ) != 0 ) {
-            ERROR_LOG( "Failed to restore the volume of the audio chunk for channel " << channel << ". The error: " << Mix_GetError() )
-        }
+    soundSampleManager.clearFinishedSamples();
 
-        // Resume the channel as soon as all its parameters are settled
-        Mix_Resume( channel );
+    std::unique_ptr<Mix_Chunk, void ( * )( Mix_Chunk * )> sample = loadChunk( ptr, size );
+    if ( !sample ) {
+        return -1;
     }
 
-    // There can be a maximum of two items in the sample queue for a channel:
-    // the previous sample (if it hasn't been freed yet) and the current one
-    soundSampleManager.channelStarted( channel, sample.release() );
-
-    return channel;
+    return playChunk( std::move( sample ), loop, {} );
 }
 
 void Mixer::setPosition( const int channelId, const int16_t angle, const uint8_t distance )
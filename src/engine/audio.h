@@ -50,10 +50,19 @@ namespace Mixer
 
     int getChannelCount();
 
-    // Starts playback of the given sound with the ability of looping it, as well as (optionally)
-    // the ability to specify the position of the sound source relative to the listener (the angle
-    // of direction to the sound source in degrees and the distance to the sound source).
-    int Play( const uint8_t * ptr, const uint32_t size, const bool loop, const std::optional<std::pair<int16_t, uint8_t>> position = {} );
+    // Sound UID is used to cache decoded sounds. It is caller's responsibility to generate them, the same UID should
+    // always be used for the same sound. This function starts playback of the given sound with the ability of looping
+    // it, as well as (optionally) the ability to specify the position of the sound source relative to the listener
+    // (the angle of direction to the sound source in degrees and the distance to the sound source).
+    int Play( const uint64_t soundUID, const uint8_t * ptr, const uint32_t size, const bool loop, const std::optional<std::pair<int16_t, uint8_t>> position = {} );
+
+    // Starts playback of the given sound without caching it. This function should be used for one-time sounds only,
+    // for example, for audio tracks of videos.
+    int Play( const uint8_t * ptr, const uint32_t size, const bool loop );
+
+    // Decodes the given sound and puts it to the cache in advance, so there will be no delay when this sound is played
+    // for the first time.
+    void preload( const uint64_t soundUID, const uint8_t * ptr, const uint32_t size );
 
     void setVolume( const int volumePercentage );
 
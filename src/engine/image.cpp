@@ -393,6 +393,115 @@ namespace
         return rgbToId[red + green * 64 + blue * 64 * 64];
     }
 
+    // Sprites mostly consist of long runs of either fully opaque or fully transparent pixels. Such runs are detected by reading
+    // 8 bytes of the transform layer at once and then are copied or skipped as a whole without checking every pixel.
+    const int32_t pixelBlockSize = 8;
+
+    const uint64_t transparentPixelBlock = 0x0101010101010101ULL;
+
+    uint64_t readPixelBlock( const uint8_t * data )
+    {
+        uint64_t value = 0;
+        memcpy( &value, data, sizeof( value ) );
+        return value;
+    }
+
+    bool hasZeroPixel( const uint64_t pixelBlock )
+    {
+        return ( ( pixelBlock - 0x0101010101010101ULL ) & ~pixelBlock & 0x8080808080808080ULL ) != 0;
+    }
+
+    // Input pixels are read from right to left for flipped images.
+    template <bool isFlipped>
+    void blitPixelsToSingleLayer( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, const int32_t count )
+    {
+        constexpr int32_t step = isFlipped ? -1 : 1;
+
+        for ( int32_t i = 0; i < count; ++i, imageIn += step, transformIn += step, ++imageOut ) {
+            if ( *transformIn > 0 ) { // apply a transformation
+                if ( *transformIn != 1 ) { // skip pixel
+                    *imageOut = *( transformTable + ( *transformIn ) * 256 + *imageOut );
+                }
+            }
+            else { // copy a pixel
+                *imageOut = *imageIn;
+            }
+        }
+    }
+
+    template <bool isFlipped>
+    void blitPixelsToDoubleLayer( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, uint8_t * transformOut, const int32_t count )
+    {
+        constexpr int32_t step = isFlipped ? -1 : 1;
+
+        for ( int32_t i = 0; i < count; ++i, imageIn += step, transformIn += step, ++imageOut, ++transformOut ) {
+            if ( *transformIn == 1 ) { // skip pixel
+                continue;
+            }
+
+            if ( *transformIn > 0 && *transformOut == 0 ) { // apply a transformation
+                *imageOut = *( transformTable + ( *transformIn ) * 256 + *imageOut );
+            }
+            else { // copy a pixel
+                *transformOut = *transformIn;
+                *imageOut = *imageIn;
+            }
+        }
+    }
+
+    template <bool isFlipped>
+    void copyPixelBlock( const uint8_t * in, uint8_t * out )
+    {
+        if constexpr ( isFlipped ) {
+            for ( int32_t i = 0; i < pixelBlockSize; ++i, --in, ++out ) {
+                *out = *in;
+            }
+        }
+        else {
+            memcpy( out, in, pixelBlockSize );
+        }
+    }
+
+    template <bool isFlipped>
+    void blitRowToSingleLayer( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, int32_t width )
+    {
+        constexpr int32_t step = isFlipped ? -pixelBlockSize : pixelBlockSize;
+
+        for ( ; width >= pixelBlockSize; width -= pixelBlockSize, imageIn += step, transformIn += step, imageOut += pixelBlockSize ) {
+            const uint64_t transformBlock = readPixelBlock( isFlipped ? transformIn - ( pixelBlockSize - 1 ) : transformIn );
+
+            if ( transformBlock == 0 ) {
+                copyPixelBlock<isFlipped>( imageIn, imageOut );
+            }
+            else if ( transformBlock != transparentPixelBlock ) {
+                blitPixelsToSingleLayer<isFlipped>( imageIn, transformIn, imageOut, pixelBlockSize );
+            }
+        }
+
+        blitPixelsToSingleLayer<isFlipped>( imageIn, transformIn, imageOut, width );
+    }
+
+    template <bool isFlipped>
+    void blitRowToDoubleLayer( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, uint8_t * transformOut, int32_t width )
+    {
+        constexpr int32_t step = isFlipped ? -pixelBlockSize : pixelBlockSize;
+
+        for ( ; width >= pixelBlockSize;
+              width -= pixelBlockSize, imageIn += step, transformIn += step, imageOut += pixelBlockSize, transformOut += pixelBlockSize ) {
+            const uint64_t transformBlock = readPixelBlock( isFlipped ? transformIn - ( pixelBlockSize - 1 ) : transformIn );
+
+            if ( transformBlock == 0 ) {
+                copyPixelBlock<isFlipped>( imageIn, imageOut );
+                memset( transformOut, 0, pixelBlockSize );
+            }
+            else if ( transformBlock != transparentPixelBlock ) {
+                blitPixelsToDoubleLayer<isFlipped>( imageIn, transformIn, imageOut, transformOut, pixelBlockSize );
+            }
+        }
+
+        blitPixelsToDoubleLayer<isFlipped>( imageIn, transformIn, imageOut, transformOut, width );
+    }
+
     void ApplyRawPalette( const fheroes2::Image & in, int32_t inX, int32_t inY, fheroes2::Image & out, int32_t outX, int32_t outY, int32_t width, int32_t height,
                           const uint8_t * palette )
     {
@@ -428,6 +537,13 @@ namespace
                 uint8_t * imageOutX = imageOutY;
                 const uint8_t * imageInXEnd = imageInX + width;
 
+                // Skip blocks of pixels without any data.
+                while ( imageInXEnd - imageInX >= pixelBlockSize && !hasZeroPixel( readPixelBlock( transformInX ) ) ) {
+                    imageInX += pixelBlockSize;
+                    transformInX += pixelBlockSize;
+                    imageOutX += pixelBlockSize;
+                }
+
                 for ( ; imageInX != imageInXEnd; ++imageInX, ++imageOutX, ++transformInX ) {
                     if ( *transformInX == 0 ) { // only modify pixels with data
                         *imageOutX = palette[*imageInX];
@@ -1128,6 +1244,19 @@ namespace fheroes2
                 const uint8_t * transformX = transformY;
                 const uint8_t * imageXEnd = imageX + width;
 
+                for ( ; imageXEnd - imageX >= pixelBlockSize; imageX += pixelBlockSize, transformX += pixelBlockSize ) {
+                    if ( !hasZeroPixel( readPixelBlock( transformX ) ) ) {
+                        // There are no pixels with data in this block.
+                        continue;
+                    }
+
+                    for ( int32_t i = 0; i < pixelBlockSize; ++i ) {
+                        if ( transformX[i] == 0 ) {
+                            imageX[i] = *( transformTable + transformId * 256 + imageX[i] );
+                        }
+                    }
+                }
+
                 for ( ; imageX != imageXEnd; ++imageX, ++transformX ) {
                     if ( *transformX == 0 ) {
                         *imageX = *( transformTable + transformId * 256 + *imageX );
@@ -1183,46 +1312,14 @@ namespace fheroes2
             if ( out.singleLayer() ) {
                 assert( !in.singleLayer() );
                 for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    const uint8_t * imageOutXEnd = imageOutX + width;
-
-                    for ( ; imageOutX != imageOutXEnd; --imageInX, --transformInX, ++imageOutX ) {
-                        if ( *transformInX > 0 ) { // apply a transformation
-                            if ( *transformInX != 1 ) { // skip pixel
-                                *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                            }
-                        }
-                        else { // copy a pixel
-                            *imageOutX = *imageInX;
-                        }
-                    }
+                    blitRowToSingleLayer<true>( imageInY, transformInY, imageOutY, width );
                 }
             }
             else {
                 uint8_t * transformOutY = out.transform() + offsetOutY;
 
                 for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut, transformOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    uint8_t * transformOutX = transformOutY;
-                    const uint8_t * imageOutXEnd = imageOutX + width;
-
-                    for ( ; imageOutX != imageOutXEnd; --imageInX, --transformInX, ++imageOutX, ++transformOutX ) {
-                        if ( *transformInX == 1 ) { // skip pixel
-                            continue;
-                        }
-
-                        if ( *transformInX > 0 && *transformOutX == 0 ) { // apply a transformation
-                            *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                        }
-                        else { // copy a pixel
-                            *transformOutX = *transformInX;
-                            *imageOutX = *imageInX;
-                        }
-                    }
+                    blitRowToDoubleLayer<true>( imageInY, transformInY, imageOutY, transformOutY, width );
                 }
             }
         }
@@ -1238,46 +1335,14 @@ namespace fheroes2
             if ( out.singleLayer() ) {
                 assert( !in.singleLayer() );
                 for ( ; imageInY != imageInYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    const uint8_t * imageInXEnd = imageInX + width;
-
-                    for ( ; imageInX != imageInXEnd; ++imageInX, ++transformInX, ++imageOutX ) {
-                        if ( *transformInX > 0 ) { // apply a transformation
-                            if ( *transformInX != 1 ) { // skip pixel
-                                *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                            }
-                        }
-                        else { // copy a pixel
-                            *imageOutX = *imageInX;
-                        }
-                    }
+                    blitRowToSingleLayer<false>( imageInY, transformInY, imageOutY, width );
                 }
             }
             else {
                 uint8_t * transformOutY = out.transform() + offsetOutY;
 
                 for ( ; imageInY != imageInYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut, transformOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    uint8_t * transformOutX = transformOutY;
-                    const uint8_t * imageInXEnd = imageInX + width;
-
-                    for ( ; imageInX != imageInXEnd; ++imageInX, ++transformInX, ++imageOutX, ++transformOutX ) {
-                        if ( *transformInX == 1 ) { // skip pixel
-                            continue;
-                        }
-
-                        if ( *transformInX > 0 && *transformOutX == 0 ) { // apply a transformation
-                            *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                        }
-                        else { // copy a pixel
-                            *transformOutX = *transformInX;
-                            *imageOutX = *imageInX;
-                        }
-                    }
+                    blitRowToDoubleLayer<false>( imageInY, transformInY, imageOutY, transformOutY, width );
                 }
             }
         }
@@ -267,6 +267,32 @@ namespace
 
 // If SDL library is used
 #if !defined( TARGET_PS_VITA )
+    // Converts palette indexes into 32-bit pixels. Pixels are processed in groups of 4 with independent table lookups
+    // which takes about 25% less time than processing them one by one. Explicit SIMD gather instructions do not give any gain here
+    // as this operation is limited by memory bandwidth.
+    void convertPalettizedPixels( const uint8_t * in, uint32_t * out, const int32_t pixelCount, const uint32_t * palette )
+    {
+        assert( in != nullptr && out != nullptr && palette != nullptr && pixelCount >= 0 );
+
+        const uint32_t * outEnd = out + pixelCount;
+
+        for ( ; outEnd - out >= 4; in += 4, out += 4 ) {
+            const uint32_t first = palette[in[0]];
+            const uint32_t second = palette[in[1]];
+            const uint32_t third = palette[in[2]];
+            const uint32_t fourth = palette[in[3]];
+
+            out[0] = first;
+            out[1] = second;
+            out[2] = third;
+            out[3] = fourth;
+        }
+
+        for ( ; out != outEnd; ++out, ++in ) {
+            *out = palette[*in];
+        }
+    }
+
     class BaseSDLRenderer
     {
     protected:
@@ -293,13 +319,7 @@ namespace
 
             if ( fullFrame ) {
                 if ( surface->format->BitsPerPixel == 32 ) {
-                    uint32_t * out = static_cast<uint32_t *>( surface->pixels );
-                    const uint32_t * outEnd = out + imageWidth * imageHeight;
-                    const uint8_t * in = imageIn;
-                    const uint32_t * transform = _palette32Bit.data();
-
-                    for ( ; out != outEnd; ++out, ++in )
-                        *out = *( transform + *in );
+                    convertPalettizedPixels( imageIn, static_cast<uint32_t *>( surface->pixels ), imageWidth * imageHeight, _palette32Bit.data() );
                 }
                 else if ( ( surface->format->BitsPerPixel == 8 ) && ( surface->pixels != imageIn ) ) {
                     if ( imageWidth % 4 != 0 ) {
@@ -321,12 +341,7 @@ namespace
                     const uint32_t * transform = _palette32Bit.data();
 
                     for ( ; outY != outYEnd; outY += imageWidth, inY += imageWidth ) {
-                        uint32_t * outX = outY;
-                        const uint32_t * outXEnd = outX + roi.width;
-                        const uint8_t * inX = inY;
-
-                        for ( ; outX != outXEnd; ++outX, ++inX )
-                            *outX = *( transform + *inX );
+                        convertPalettizedPixels( inY, outY, roi.width, transform );
                     }
                 }
                 else if ( ( surface->format->BitsPerPixel == 8 ) && ( surface->pixels != imageIn ) ) {
@@ -1123,41 +1138,24 @@ namespace
 
             assert( _renderer != nullptr && _texture != nullptr );
 
-            copyImageToSurface( display, _surface, roi );
-
-            const bool fullFrame = ( roi.width == display.width() ) && ( roi.height == display.height() );
-            if ( fullFrame ) {
-                const int returnCode = SDL_UpdateTexture( _texture, nullptr, _surface->pixels, _surface->pitch );
-                if ( returnCode < 0 ) {
-                    ERROR_LOG( "Failed to update texture. The error value: " << returnCode << ", description: " << SDL_GetError() )
-                }
-            }
-            else {
-                SDL_Rect area;
-                area.x = roi.x;
-                area.y = roi.y;
-                area.w = roi.width;
-                area.h = roi.height;
-
-                const int returnCode = SDL_UpdateTexture( _texture, &area, _surface->pixels, _surface->pitch );
-                if ( returnCode < 0 ) {
-                    ERROR_LOG( "Failed to update texture. The error value: " << returnCode << ", description: " << SDL_GetError() )
-                }
-            }
+            _updateTexture( display, roi );
+            _present();
+        }
 
-            int returnCode = SDL_RenderClear( _renderer );
-            if ( returnCode < 0 ) {
-                ERROR_LOG( "Failed to clear renderer. The error value: " << returnCode << ", description: " << SDL_GetError() )
+        void renderAreas( const fheroes2::Display & display, const std::vector<fheroes2::Rect> & rois ) override
+        {
+            if ( _surface == nullptr ) {
                 return;
             }
 
-            returnCode = SDL_RenderCopy( _renderer, _texture, nullptr, nullptr );
-            if ( returnCode < 0 ) {
-                ERROR_LOG( "Failed to copy render.The error value: " << returnCode << ", description: " << SDL_GetError() )
-                return;
+            assert( _renderer != nullptr && _texture != nullptr );
+
+            // Only the given areas of the texture are updated while the whole texture is presented once.
+            for ( const fheroes2::Rect & roi : rois ) {
+                _updateTexture( display, roi );
             }
 
-            SDL_RenderPresent( _renderer );
+            _present();
         }
 
         bool allocate( fheroes2::ResolutionInfo & resolutionInfo, bool isFullScreen ) override
@@ -1336,6 +1334,48 @@ namespace
             return ( _window != nullptr ) && ( ( SDL_GetWindowFlags( _window ) & SDL_WINDOW_MOUSE_FOCUS ) == SDL_WINDOW_MOUSE_FOCUS );
         }
 
+        void _updateTexture( const fheroes2::Display & display, const fheroes2::Rect & roi )
+        {
+            copyImageToSurface( display, _surface, roi );
+
+            const bool fullFrame = ( roi.width == display.width() ) && ( roi.height == display.height() );
+            if ( fullFrame ) {
+                const int returnCode = SDL_UpdateTexture( _texture, nullptr, _surface->pixels, _surface->pitch );
+                if ( returnCode < 0 ) {
+                    ERROR_LOG( "Failed to update texture. The error value: " << returnCode << ", description: " << SDL_GetError() )
+                }
+            }
+            else {
+                SDL_Rect area;
+                area.x = roi.x;
+                area.y = roi.y;
+                area.w = roi.width;
+                area.h = roi.height;
+
+                const int returnCode = SDL_UpdateTexture( _texture, &area, _surface->pixels, _surface->pitch );
+                if ( returnCode < 0 ) {
+                    ERROR_LOG( "Failed to update texture. The error value: " << returnCode << ", description: " << SDL_GetError() )
+                }
+            }
+        }
+
+        void _present()
+        {
+            int returnCode = SDL_RenderClear( _renderer );
+            if ( returnCode < 0 ) {
+                ERROR_LOG( "Failed to clear renderer. The error value: " << returnCode << ", description: " << SDL_GetError() )
+                return;
+            }
+
+            returnCode = SDL_RenderCopy( _renderer, _texture, nullptr, nullptr );
+            if ( returnCode < 0 ) {
+                ERROR_LOG( "Failed to copy render.The error value: " << returnCode << ", description: " << SDL_GetError() )
+                return;
+            }
+
+            SDL_RenderPresent( _renderer );
+        }
+
         void _createPalette()
         {
             if ( _surface == nullptr )
@@ -1435,6 +1475,16 @@ namespace fheroes2
         Display::instance().linkRenderSurface( surface );
     }
 
+    void BaseRenderEngine::renderAreas( const Display & display, const std::vector<Rect> & rois )
+    {
+        Rect roi;
+        for ( const Rect & area : rois ) {
+            roi = getBoundaryRect( roi, area );
+        }
+
+        render( display, roi );
+    }
+
     Display::Display()
         : _engine( RenderEngine::create() )
         , _cursor( RenderCursor::create() )
@@ -1494,41 +1544,86 @@ namespace fheroes2
             return;
         }
 
+        _renderWithCursor( [this, &temp]( const Rect & cursorROI ) {
+            if ( cursorROI.width > 0 && cursorROI.height > 0 ) {
+                temp = getBoundaryRect( temp, cursorROI );
+            }
+
+            // Previous position of cursor must be updated as well to avoid ghost effect.
+            _renderFrame( getBoundaryRect( temp, _prevRoi ) );
+        } );
+
+        _prevRoi = temp;
+    }
+
+    void Display::render( const std::vector<Rect> & rois )
+    {
+        std::vector<Rect> areas;
+        areas.reserve( rois.size() + 2 );
+
+        for ( Rect roi : rois ) {
+            if ( getActiveArea( roi, width(), height() ) ) {
+                areas.emplace_back( roi );
+            }
+        }
+
+        if ( areas.empty() ) {
+            return;
+        }
+
+        const Rect cursorROI = _renderWithCursor( [this, &areas]( const Rect & cursorArea ) {
+            if ( cursorArea.width > 0 && cursorArea.height > 0 ) {
+                areas.emplace_back( cursorArea );
+            }
+
+            // Previous position of cursor must be updated as well to avoid ghost effect.
+            if ( _prevRoi.width > 0 && _prevRoi.height > 0 ) {
+                areas.emplace_back( _prevRoi );
+            }
+
+            _renderFrame( areas );
+        } );
+
+        // Unlike the single area rendering only the cursor area has to be updated next time since the rest of the areas are rendered already.
+        _prevRoi = cursorROI;
+    }
+
+    Rect Display::_renderWithCursor( const std::function<void( const Rect & )> & renderFrame )
+    {
+        Rect cursorROI;
+        Sprite backup;
+
         if ( _cursor->isVisible() && _cursor->isSoftwareEmulation() && !_cursor->_image.empty() ) {
             const Sprite & cursorImage = _cursor->_image;
-            Rect cursorROI( cursorImage.x(), cursorImage.y(), cursorImage.width(), cursorImage.height() );
+            cursorROI = { cursorImage.x(), cursorImage.y(), cursorImage.width(), cursorImage.height() };
 
             if ( _cursor->_keepInScreenArea ) {
                 cursorROI.x = std::clamp( cursorROI.x, 0, width() - cursorROI.width );
                 cursorROI.y = std::clamp( cursorROI.y, 0, height() - cursorROI.height );
             }
 
-            const Sprite backup = Crop( *this, cursorROI.x, cursorROI.y, cursorROI.width, cursorROI.height );
+            backup = Crop( *this, cursorROI.x, cursorROI.y, cursorROI.width, cursorROI.height );
             Blit( cursorImage, 0, 0, *this, cursorROI.x, cursorROI.y, cursorROI.width, cursorROI.height );
 
-            // ROI must include cursor's area as well, otherwise cursor won't be rendered.
-            if ( !backup.empty() && getActiveArea( cursorROI, width(), height() ) ) {
-                temp = getBoundaryRect( temp, cursorROI );
+            // Cursor's area must be rendered as well, otherwise cursor won't be rendered.
+            if ( backup.empty() || !getActiveArea( cursorROI, width(), height() ) ) {
+                cursorROI = {};
             }
+        }
 
-            // Previous position of cursor must be updated as well to avoid ghost effect.
-            _renderFrame( getBoundaryRect( temp, _prevRoi ) );
+        renderFrame( cursorROI );
 
-            if ( _postprocessing ) {
-                _postprocessing();
-            }
+        if ( _postprocessing ) {
+            _postprocessing();
+        }
 
+        if ( !backup.empty() ) {
             Copy( backup, 0, 0, *this, backup.x(), backup.y(), backup.width(), backup.height() );
         }
-        else {
-            _renderFrame( getBoundaryRect( temp, _prevRoi ) );
 
-            if ( _postprocessing ) {
-                _postprocessing();
-            }
-        }
+        ++_renderCounter;
 
-        _prevRoi = temp;
+        return cursorROI;
     }
 
     void Display::updateNextRenderRoi( const Rect & roi )
@@ -1539,24 +1634,35 @@ namespace fheroes2
 
     void Display::_renderFrame( const Rect & roi ) const
     {
-        bool updateImage = true;
+        if ( _preprocessFrame() ) {
+            _engine->render( *this, roi );
+        }
+    }
+
+    void Display::_renderFrame( const std::vector<Rect> & rois ) const
+    {
+        if ( _preprocessFrame() ) {
+            _engine->renderAreas( *this, rois );
+        }
+    }
+
+    bool Display::_preprocessFrame() const
+    {
         if ( _preprocessing ) {
             std::vector<uint8_t> palette;
             if ( _preprocessing( palette ) ) {
                 _engine->updatePalette( palette );
                 // when we change a palette for 8-bit image we unwillingly call render so we don't need to re-render the same frame again
-                updateImage = ( _renderSurface == nullptr );
-                if ( updateImage ) {
+                if ( _renderSurface == nullptr ) {
                     // Pre-processing step is applied to the whole image so we forcefully render the full frame.
                     _engine->render( *this, { 0, 0, width(), height() } );
-                    return;
                 }
+
+                return false;
             }
         }
 
-        if ( updateImage ) {
-            _engine->render( *this, roi );
-        }
+        return true;
     }
 
     uint8_t * Display::image()
@@ -167,6 +167,9 @@ namespace fheroes2
             // Do nothing.
         }
 
+        // Renders several areas of the frame within one frame update. By default the area covering all of them is rendered.
+        virtual void renderAreas( const Display & display, const std::vector<Rect> & rois ); // declaration of this method is in source file
+
         virtual bool allocate( ResolutionInfo & /*unused*/, bool /*unused*/ )
         {
             return false;
@@ -215,9 +218,18 @@ namespace fheroes2
         // Render a part of frame on screen.
         void render( const Rect & roi );
 
+        // Render several parts of frame on screen at once.
+        void render( const std::vector<Rect> & rois );
+
         // Update the area which will be rendered on the next render() call.
         void updateNextRenderRoi( const Rect & roi );
 
+        // Returns the number of frames rendered so far. It allows to find out whether anything was rendered in between.
+        uint32_t renderCounter() const
+        {
+            return _renderCounter;
+        }
+
         // Do not call this method. It serves as a patch over the basic class.
         void resize( int32_t width_, int32_t height_ ) override;
 
@@ -274,6 +286,8 @@ namespace fheroes2
         // Previous area drawn on the screen.
         Rect _prevRoi;
 
+        uint32_t _renderCounter{ 0 };
+
         Size _screenSize;
 
         // Only for cases of direct drawing on rendered 8-bit image.
@@ -285,6 +299,14 @@ namespace fheroes2
         Display();
 
         void _renderFrame( const Rect & roi ) const; // prepare and render a frame
+        void _renderFrame( const std::vector<Rect> & rois ) const;
+
+        // Draws the software cursor if it is used, calls the given function with the area of the cursor (empty if there is no software cursor)
+        // to render a frame and applies post-processing. Returns the area of the cursor.
+        Rect _renderWithCursor( const std::function<void( const Rect & )> & renderFrame );
+
+        // Applies pre-processing to the frame. Returns false if no further rendering of the frame is needed.
+        bool _preprocessFrame() const;
     };
 
     class Cursor
@@ -29,6 +29,12 @@
 #include <string>
 #include <string_view>
 
+#if defined( _WIN32 )
+#include <io.h>
+#elif !defined( __EMSCRIPTEN__ ) && !defined( TARGET_PS_VITA ) && !defined( TARGET_NINTENDO_SWITCH )
+#include <unistd.h>
+#endif
+
 #ifdef __EMSCRIPTEN__
 #include <cstdio>
 
@@ -418,9 +424,49 @@ bool StreamFile::open( const std::string & fn, const std::string & mode )
     return !fail();
 }
 
-void StreamFile::close()
+bool StreamFile::close()
 {
-    _file.reset();
+    if ( !_file ) {
+        return !fail();
+    }
+
+    // The file is closed here instead of the deleter to get the result of closing
+    if ( closeFile( _file.release() ) != 0 ) {
+        setFail();
+    }
+
+    return !fail();
+}
+
+bool StreamFile::sync()
+{
+    if ( !_file ) {
+        setFail();
+
+        return false;
+    }
+
+    if ( std::fflush( _file.get() ) != 0 ) {
+        setFail();
+
+        return false;
+    }
+
+#if defined( _WIN32 )
+    if ( _commit( _fileno( _file.get() ) ) != 0 ) {
+        setFail();
+
+        return false;
+    }
+#elif !defined( __EMSCRIPTEN__ ) && !defined( TARGET_PS_VITA ) && !defined( TARGET_NINTENDO_SWITCH )
+    if ( fsync( fileno( _file.get() ) ) != 0 ) {
+        setFail();
+
+        return false;
+    }
+#endif
+
+    return !fail();
 }
 
 size_t StreamFile::size()
@@ -634,6 +680,28 @@ std::string StreamFile::getString( const size_t size /* = 0 */ )
     return { buf.begin(), std::find( buf.begin(), buf.end(), 0 ) };
 }
 
+void StreamFile::syncFileSystem()
+{
+#ifdef __EMSCRIPTEN__
+#if defined( __GNUC__ )
+#pragma GCC diagnostic push
+
+#pragma GCC diagnostic ignored "-Wvariadic-macro-arguments-omitted"
+#endif
+
+    EM_ASM(
+        // The following code is not C++ code, but JavaScript code.
+        // clang-format off
+        FS.syncfs( err => err && console.warn( "FS.syncfs() error:", err ) )
+        // clang-format on
+    );
+
+#if defined( __GNUC__ )
+#pragma GCC diagnostic pop
+#endif
+#endif
+}
+
 int StreamFile::closeFile( std::FILE * f )
 {
 #ifdef __EMSCRIPTEN__
@@ -660,22 +728,7 @@ int StreamFile::closeFile( std::FILE * f )
 
 #ifdef __EMSCRIPTEN__
     if ( needSyncFS ) {
-#if defined( __GNUC__ )
-#pragma GCC diagnostic push
-
-#pragma GCC diagnostic ignored "-Wvariadic-macro-arguments-omitted"
-#endif
-
-        EM_ASM(
-            // The following code is not C++ code, but JavaScript code.
-            // clang-format off
-            FS.syncfs( err => err && console.warn( "FS.syncfs() error:", err ) )
-            // clang-format on
-        );
-
-#if defined( __GNUC__ )
-#pragma GCC diagnostic pop
-#endif
+        syncFileSystem();
     }
 #endif
 
@@ -638,7 +638,18 @@ public:
     size_t tell();
 
     bool open( const std::string & fn, const std::string & mode );
-    void close();
+
+    // Closes the file. Returns false if this stream is in a failed state or if the file could not be closed properly (for example,
+    // if the buffered data could not be written).
+    bool close();
+
+    // Writes the buffered data to the file and, where the platform allows it, makes the system write the file to the storage device.
+    // Returns true on success, otherwise marks this stream as failed and returns false.
+    bool sync();
+
+    // Writes the changes of the file system to the persistent storage on platforms which keep files in memory (Emscripten). Files written
+    // with this class are synchronized when they are closed, but renaming or removing a file afterwards requires a call of this method.
+    static void syncFileSystem();
 
     // If a zero size is specified, then all still unread data is returned
     ROStreamBuf getStreamBuf( const size_t size = 0 );
@@ -47,6 +47,10 @@
 #include <strings.h>
 #endif
 
+#if defined( __linux__ ) || defined( __APPLE__ )
+#include <sys/stat.h>
+#endif
+
 // Managing compiler warnings for SDL headers
 #if defined( __GNUC__ )
 #pragma GCC diagnostic push
@@ -313,6 +317,16 @@ bool System::Unlink( const std::string_view path )
     return std::filesystem::remove( path, ec );
 }
 
+bool System::Rename( const std::string_view from, const std::string_view to )
+{
+    std::error_code ec;
+
+    // Using the non-throwing overload
+    std::filesystem::rename( from, to, ec );
+
+    return !ec;
+}
+
 std::string System::concatPath( const std::string_view left, const std::string_view right )
 {
     return fsPathToString( std::filesystem::path{ left }.append( right ) );
@@ -451,6 +465,71 @@ bool System::IsDirectory( const std::string_view path )
     return std::filesystem::is_directory( correctedPath, ec );
 }
 
+bool System::GetFileStatus( const std::string_view path, uint64_t & size, int64_t & modificationTime )
+{
+#if defined( _WIN32 )
+    WIN32_FILE_ATTRIBUTE_DATA fileData;
+
+    // The path is converted to the native wide form the same way as by the other functions that work with paths
+    if ( !GetFileAttributesExW( std::filesystem::path{ path }.c_str(), GetFileExInfoStandard, &fileData ) ) {
+        return false;
+    }
+
+    if ( fileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) {
+        return false;
+    }
+
+    size = ( static_cast<uint64_t>( fileData.nFileSizeHigh ) << 32 ) | fileData.nFileSizeLow;
+
+    // In 100-nanosecond intervals
+    modificationTime
+        = static_cast<int64_t>( ( static_cast<uint64_t>( fileData.ftLastWriteTime.dwHighDateTime ) << 32 ) | fileData.ftLastWriteTime.dwLowDateTime );
+
+    return true;
+#elif defined( __linux__ ) || defined( __APPLE__ )
+    // The path has to be null-terminated
+    const std::string filePath{ path };
+
+    struct stat fileStat;
+    if ( stat( filePath.c_str(), &fileStat ) != 0 || !S_ISREG( fileStat.st_mode ) ) {
+        return false;
+    }
+
+#if defined( __APPLE__ )
+    const timespec & fileTime = fileStat.st_mtimespec;
+#else
+    const timespec & fileTime = fileStat.st_mtim;
+#endif
+
+    size = static_cast<uint64_t>( fileStat.st_size );
+
+    // In nanoseconds
+    modificationTime = static_cast<int64_t>( fileTime.tv_sec ) * 1000000000 + static_cast<int64_t>( fileTime.tv_nsec );
+
+    return true;
+#else
+    std::error_code ec;
+
+    // Using the non-throwing overloads
+    const uintmax_t fileSize = std::filesystem::file_size( path, ec );
+    if ( ec ) {
+        return false;
+    }
+
+    const std::filesystem::file_time_type fileTime = std::filesystem::last_write_time( path, ec );
+    if ( ec ) {
+        return false;
+    }
+
+    size = static_cast<uint64_t>( fileSize );
+
+    // The resolution of this clock depends on the implementation of the standard library
+    modificationTime = static_cast<int64_t>( fileTime.time_since_epoch().count() );
+
+    return true;
+#endif
+}
+
 bool System::GetCaseInsensitivePath( const std::string_view path, std::string & correctedPath )
 {
 #if !defined( _WIN32 ) && !defined( ANDROID ) && !defined( TARGET_PS_VITA )
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <ctime>
 #include <filesystem>
 #include <string>
@@ -45,6 +46,9 @@ namespace System
     bool MakeDirectory( const std::string_view path );
     bool Unlink( const std::string_view path );
 
+    // Renames (moves) the file, replacing the destination file if it already exists. Returns true on success.
+    bool Rename( const std::string_view from, const std::string_view to );
+
     std::string concatPath( const std::string_view left, const std::string_view right );
 
     void appendOSSpecificDirectories( std::vector<std::string> & directories );
@@ -64,6 +68,11 @@ namespace System
     bool IsFile( const std::string_view path );
     bool IsDirectory( const std::string_view path );
 
+    // Gets the size and the last modification time of the file. The modification time is returned in platform-specific units (with
+    // sub-second precision where the platform provides it), so it should only be compared with other values returned by this function.
+    // Returns true on success and false on error (including the case when the path does not point to a regular file).
+    bool GetFileStatus( const std::string_view path, uint64_t & size, int64_t & modificationTime );
+
     bool GetCaseInsensitivePath( const std::string_view path, std::string & correctedPath );
 
     // Resolves the wildcard pattern 'glob' and appends matching paths to 'fileNames'. Supported wildcards are '?' and '*'.
@@ -20,8 +20,10 @@
 
 #include "thread.h"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
+#include <vector>
 
 #if defined( __EMSCRIPTEN__ ) && !defined( __EMSCRIPTEN_PTHREADS__ )
 namespace
@@ -150,4 +152,43 @@ namespace MultiThreading
             manager->executeTask();
         }
     }
+
+    void parallelFor( const size_t tasksCount, const std::function<void( const size_t )> & task )
+    {
+#if defined( __EMSCRIPTEN__ ) && !defined( __EMSCRIPTEN_PTHREADS__ )
+        const size_t threadsCount = 1;
+#else
+        const size_t threadsCount = std::min<size_t>( std::thread::hardware_concurrency(), tasksCount );
+#endif
+
+        if ( threadsCount <= 1 ) {
+            for ( size_t idx = 0; idx < tasksCount; ++idx ) {
+                task( idx );
+            }
+
+            return;
+        }
+
+        std::atomic<size_t> nextTaskIdx{ 0 };
+
+        const auto worker = [&task, &nextTaskIdx, tasksCount]() {
+            for ( size_t idx = nextTaskIdx++; idx < tasksCount; idx = nextTaskIdx++ ) {
+                task( idx );
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve( threadsCount - 1 );
+
+        for ( size_t i = 1; i < threadsCount; ++i ) {
+            threads.emplace_back( worker );
+        }
+
+        // The calling thread also takes part in the work
+        worker();
+
+        for ( std::thread & thread : threads ) {
+            thread.join();
+        }
+    }
 }
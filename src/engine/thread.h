@@ -22,6 +22,8 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -70,4 +72,10 @@ namespace MultiThreading
 
         static void _workerThread( AsyncManager * manager );
     };
+
+    // Executes the task for every index in the range [0, tasksCount), distributing the work among all the available hardware threads
+    // (including the calling one). The order in which the tasks are executed is unspecified, so tasks must be independent of each other.
+    // This function returns after all the tasks have been completed. If multithreading is not available, then tasks are executed
+    // sequentially in the calling thread.
+    void parallelFor( const size_t tasksCount, const std::function<void( const size_t )> & task );
 }
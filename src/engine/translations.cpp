@@ -278,17 +278,32 @@ namespace
         return iter->second;
     }
 
-    uint32_t crc32b( const std::string_view str )
-    {
-        uint32_t crc = 0xFFFFFFFF;
+    constexpr std::array<uint32_t, 256> crc32bTable = []() {
+        std::array<uint32_t, 256> table{};
 
-        for ( const char ch : str ) {
-            crc ^= static_cast<uint32_t>( ch );
+        for ( uint32_t i = 0; i < 256; ++i ) {
+            uint32_t crc = i;
 
             for ( int bit = 0; bit < 8; ++bit ) {
                 const uint32_t poly = ( crc & 1 ) ? 0xEDB88320 : 0x0;
                 crc = ( crc >> 1 ) ^ poly;
             }
+
+            table[i] = crc;
+        }
+
+        return table;
+    }();
+
+    uint32_t crc32b( const std::string_view str )
+    {
+        uint32_t crc = 0xFFFFFFFF;
+
+        for ( const char ch : str ) {
+            // Characters are sign-extended here to produce the same hashes as the bit-by-bit calculation did.
+            const uint32_t value = crc ^ static_cast<uint32_t>( ch );
+
+            crc = ( value >> 8 ) ^ crc32bTable[value & 0xFF];
         }
 
         return ~crc;
@@ -329,6 +344,13 @@ namespace
     public:
         MOFile() = default;
 
+        // Translations point to the file data so MO files must not be copied.
+        MOFile( const MOFile & ) = delete;
+        MOFile( MOFile && ) = default;
+
+        MOFile & operator=( const MOFile & ) = delete;
+        MOFile & operator=( MOFile && ) = default;
+
         const char * ngettext( const char * str, const size_t plural ) const
         {
             if ( !_isValid ) {
@@ -337,22 +359,19 @@ namespace
                 return stripContext( str );
             }
 
-            const auto iter = std::as_const( _translations ).find( crc32b( str ) );
-            if ( iter == _translations.cend() ) {
-                return stripContext( str );
-            }
+            return getTranslation( findCachedEntry( str ), str, plural );
+        }
 
-            const auto & [dummy, pluralFormTranslations] = *iter;
-            if ( plural >= pluralFormTranslations.size() ) {
-                return stripContext( str );
-            }
+        const char * ngettext( const std::string & str, const size_t plural ) const
+        {
+            if ( !_isValid ) {
+                assert( 0 );
 
-            const std::string & translatedStr = pluralFormTranslations[plural];
-            if ( translatedStr.empty() ) {
-                return stripContext( str );
+                return stripContext( str.c_str() );
             }
 
-            return translatedStr.c_str();
+            // Addresses of strings stored in std::string objects are not stable so they are not cached.
+            return getTranslation( findEntry( str ), str.c_str(), plural );
         }
 
         bool load( const std::string_view langName, const std::string & fileName )
@@ -364,7 +383,8 @@ namespace
                 return false;
             }
 
-            ROStreamBuf sb = sf.getStreamBuf();
+            // The file data is kept as is and all translations point to it.
+            _data = sf.getRaw( 0 );
             if ( sf.fail() ) {
                 ERROR_LOG( "I/O error when reading " << fileName )
                 return false;
@@ -372,6 +392,8 @@ namespace
 
             sf.close();
 
+            ROStreamBuf sb( _data );
+
             {
                 const uint32_t magicNumber = sb.getLE32();
                 if ( sb.fail() ) {
@@ -447,7 +469,7 @@ namespace
                 sb.seek( origStrOff );
 
                 const std::string_view origStr = sb.getStringView( origStrLen );
-                if ( sb.fail() ) {
+                if ( sb.fail() || !isNullTerminated( origStrOff, origStrLen ) ) {
                     ERROR_LOG( "I/O error when parsing " << fileName )
                     return false;
                 }
@@ -466,19 +488,17 @@ namespace
                     continue;
                 }
 
-                sb.seek( tranStrOff );
-
-                const auto [tranBufPtr, tranBufLen] = sb.getRawView( tranStrLen );
-                if ( sb.fail() ) {
+                // Plural forms of the translation are separated by null characters and the last form is null-terminated as well.
+                if ( !isNullTerminated( tranStrOff, tranStrLen ) ) {
                     ERROR_LOG( "I/O error when parsing " << fileName )
                     return false;
                 }
 
-                static_assert( std::is_same_v<std::remove_const_t<std::remove_reference_t<decltype( *tranBufPtr )>>, unsigned char> );
+                static_assert( std::is_same_v<std::remove_const_t<std::remove_reference_t<decltype( _data[0] )>>, unsigned char> );
+
+                const TranslationEntry entry{ origStr.data(), reinterpret_cast<const char *>( _data.data() + tranStrOff ), tranStrLen };
 
-                if ( const auto [dummy, inserted]
-                     = _translations.try_emplace( crc32b( origStr ), StringSplit( { reinterpret_cast<const char *>( tranBufPtr ), tranBufLen }, '\0' ) );
-                     !inserted ) {
+                if ( const auto [dummy, inserted] = _translations.try_emplace( crc32b( origStr ), entry ); !inserted ) {
                     ERROR_LOG( "Hash collision detected for string \"" << origStr << "\"" )
                 }
             }
@@ -541,8 +561,91 @@ namespace
         }
 
     private:
+        // Both strings point to the MO file data.
+        struct TranslationEntry
+        {
+            // The original string as it is used in the source code.
+            const char * original{ nullptr };
+
+            // All plural forms of the translation separated by null characters.
+            const char * translation{ nullptr };
+            uint32_t translationLength{ 0 };
+
+            // Returns nullptr if there is no such plural form.
+            const char * getPluralForm( const size_t plural ) const
+            {
+                const char * form = translation;
+                const char * end = translation + translationLength;
+
+                for ( size_t i = 0; i < plural; ++i ) {
+                    form = static_cast<const char *>( std::memchr( form, '\0', static_cast<size_t>( end - form ) ) );
+                    if ( form == nullptr || ++form >= end ) {
+                        return nullptr;
+                    }
+                }
+
+                return form;
+            }
+        };
+
+        bool isNullTerminated( const uint32_t offset, const uint32_t length ) const
+        {
+            return static_cast<size_t>( offset ) + length < _data.size() && _data[static_cast<size_t>( offset ) + length] == 0;
+        }
+
+        const TranslationEntry * findEntry( const std::string_view str ) const
+        {
+            const auto iter = _translations.find( crc32b( str ) );
+            if ( iter == _translations.end() ) {
+                return nullptr;
+            }
+
+            return &iter->second;
+        }
+
+        // Most of the strings to be translated are string literals so the result of the search is cached using the address of the string.
+        // Since the same address can be used for different strings (for example, a buffer on the stack), the cached result is valid only
+        // if the string still matches the original one. Strings without translation are not cached.
+        const TranslationEntry * findCachedEntry( const char * str ) const
+        {
+            // Strings are translated by multiple threads, so each of them has its own cache.
+            thread_local std::pair<const MOFile *, std::unordered_map<const char *, const TranslationEntry *>> lookupCache;
+
+            auto & [cacheOwner, cachedEntries] = lookupCache;
+            if ( cacheOwner != this ) {
+                cacheOwner = this;
+                cachedEntries.clear();
+            }
+
+            if ( const auto iter = cachedEntries.find( str ); iter != cachedEntries.end() && std::strcmp( str, iter->second->original ) == 0 ) {
+                return iter->second;
+            }
+
+            const TranslationEntry * entry = findEntry( str );
+            if ( entry != nullptr ) {
+                cachedEntries.insert_or_assign( str, entry );
+            }
+
+            return entry;
+        }
+
+        static const char * getTranslation( const TranslationEntry * entry, const char * str, const size_t plural )
+        {
+            if ( entry == nullptr ) {
+                return stripContext( str );
+            }
+
+            const char * translatedStr = entry->getPluralForm( plural );
+            if ( translatedStr == nullptr || *translatedStr == '\0' ) {
+                return stripContext( str );
+            }
+
+            return translatedStr;
+        }
+
         LocaleType _locale{ LocaleType::LOCALE_EN };
-        std::unordered_map<uint32_t, std::vector<std::string>> _translations;
+        std::vector<uint8_t> _data;
+        std::unordered_map<uint32_t, TranslationEntry> _translations;
         std::string _encoding;
         bool _isValid{ false };
     };
@@ -603,7 +706,7 @@ void Translation::reset()
 
 const char * Translation::gettext( const std::string & str )
 {
-    return current ? current->ngettext( str.c_str(), 0 ) : stripContext( str.c_str() );
+    return current ? current->ngettext( str, 0 ) : stripContext( str.c_str() );
 }
 
 const char * Translation::gettext( const char * str )
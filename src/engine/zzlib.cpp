@@ -23,7 +23,10 @@
 
 #include "zzlib.h"
 
+#include <algorithm>
+#include <cassert>
 #include <cstring>
+#include <limits>
 #include <ostream>
 
 #include <zconf.h>
@@ -35,6 +38,9 @@
 namespace
 {
     constexpr uint16_t FORMAT_VERSION_0 = 0;
+
+    // Size of the buffers used by the streaming compression and decompression
+    constexpr size_t streamBufferSize = 64 * 1024;
 }
 
 std::vector<uint8_t> Compression::unzipData( const uint8_t * src, const size_t srcSize, size_t realSize /* = 0 */ )
@@ -174,6 +180,404 @@ bool Compression::zipStreamBuf( const IStreamBuf & inputStream, OStreamBase & ou
     return !outputStream.fail();
 }
 
+Compression::ZipInputStream::ZipInputStream( IStreamBase & inputStream )
+    : _inputStream( inputStream )
+    , _zStream( std::make_unique<z_stream_s>() )
+{
+    const uint32_t rawSize = _inputStream.get32();
+    const uint32_t zipSize = _inputStream.get32();
+    const uint16_t version = _inputStream.get16();
+
+    _inputStream.skip( 2 ); // Unused bytes
+
+    if ( _inputStream.fail() || zipSize == 0 || version != FORMAT_VERSION_0 ) {
+        _zStream.reset();
+        setFail();
+
+        return;
+    }
+
+    const int ret = inflateInit( _zStream.get() );
+    if ( ret != Z_OK ) {
+        ERROR_LOG( "zlib error: " << ret )
+
+        _zStream.reset();
+        setFail();
+
+        return;
+    }
+
+    _rawSizeLeft = rawSize;
+    _zipSizeLeft = zipSize;
+
+    _outputBuffer.resize( streamBufferSize );
+}
+
+Compression::ZipInputStream::~ZipInputStream()
+{
+    if ( _zStream ) {
+        inflateEnd( _zStream.get() );
+    }
+}
+
+void Compression::ZipInputStream::skip( size_t size )
+{
+    read( nullptr, size );
+}
+
+uint16_t Compression::ZipInputStream::getBE16()
+{
+    uint16_t result = ( static_cast<uint16_t>( get8() ) << 8 );
+
+    result |= get8();
+
+    return result;
+}
+
+uint16_t Compression::ZipInputStream::getLE16()
+{
+    uint16_t result = get8();
+
+    result |= ( static_cast<uint16_t>( get8() ) << 8 );
+
+    return result;
+}
+
+uint32_t Compression::ZipInputStream::getBE32()
+{
+    uint32_t result = ( static_cast<uint32_t>( get8() ) << 24 );
+
+    result |= ( static_cast<uint32_t>( get8() ) << 16 );
+    result |= ( static_cast<uint32_t>( get8() ) << 8 );
+    result |= get8();
+
+    return result;
+}
+
+uint32_t Compression::ZipInputStream::getLE32()
+{
+    uint32_t result = get8();
+
+    result |= ( static_cast<uint32_t>( get8() ) << 8 );
+    result |= ( static_cast<uint32_t>( get8() ) << 16 );
+    result |= ( static_cast<uint32_t>( get8() ) << 24 );
+
+    return result;
+}
+
+std::vector<uint8_t> Compression::ZipInputStream::getRaw( const size_t size )
+{
+    const size_t chunkSize = size > 0 ? size : _rawSizeLeft;
+    if ( chunkSize == 0 || fail() ) {
+        return {};
+    }
+
+    std::vector<uint8_t> v( chunkSize, 0 );
+
+    if ( !read( v.data(), chunkSize ) ) {
+        return {};
+    }
+
+    return v;
+}
+
+uint8_t Compression::ZipInputStream::get8()
+{
+    // Fast path for the most common case
+    if ( _outputPos < _outputSize && _rawSizeLeft > 0 ) {
+        --_rawSizeLeft;
+
+        return _outputBuffer[_outputPos++];
+    }
+
+    uint8_t v = 0;
+    read( &v, 1 );
+
+    return v;
+}
+
+bool Compression::ZipInputStream::read( uint8_t * data, size_t size )
+{
+    if ( fail() ) {
+        return false;
+    }
+
+    if ( size > _rawSizeLeft ) {
+        _rawSizeLeft = 0;
+        setFail();
+
+        return false;
+    }
+
+    _rawSizeLeft -= size;
+
+    while ( size > 0 ) {
+        if ( _outputPos == _outputSize && !fillOutputBuffer() ) {
+            return false;
+        }
+
+        const size_t chunkSize = std::min( size, _outputSize - _outputPos );
+
+        if ( data != nullptr ) {
+            std::memcpy( data, _outputBuffer.data() + _outputPos, chunkSize );
+            data += chunkSize;
+        }
+
+        _outputPos += chunkSize;
+        size -= chunkSize;
+    }
+
+    return true;
+}
+
+bool Compression::ZipInputStream::fillOutputBuffer()
+{
+    assert( _zStream && _outputPos == _outputSize );
+
+    _zStream->next_out = _outputBuffer.data();
+    _zStream->avail_out = static_cast<uInt>( _outputBuffer.size() );
+
+    // Decompress until at least some data is produced
+    while ( _zStream->avail_out == _outputBuffer.size() ) {
+        if ( _zStream->avail_in == 0 ) {
+            if ( _zipSizeLeft == 0 ) {
+                // The compressed data has ended unexpectedly
+                setFail();
+
+                return false;
+            }
+
+            const size_t chunkSize = std::min( _zipSizeLeft, streamBufferSize );
+
+            _inputBuffer = _inputStream.getRaw( chunkSize );
+            if ( _inputStream.fail() || _inputBuffer.size() != chunkSize ) {
+                setFail();
+
+                return false;
+            }
+
+            _zipSizeLeft -= chunkSize;
+
+            _zStream->next_in = _inputBuffer.data();
+            _zStream->avail_in = static_cast<uInt>( chunkSize );
+        }
+
+        const int ret = inflate( _zStream.get(), Z_NO_FLUSH );
+        if ( ret == Z_STREAM_END ) {
+            break;
+        }
+
+        if ( ret != Z_OK ) {
+            ERROR_LOG( "zlib error: " << ret )
+
+            setFail();
+
+            return false;
+        }
+    }
+
+    _outputPos = 0;
+    _outputSize = _outputBuffer.size() - _zStream->avail_out;
+
+    if ( _outputSize == 0 ) {
+        // The end of the compressed data has been reached, but more data was requested
+        setFail();
+
+        return false;
+    }
+
+    return true;
+}
+
+Compression::ZipOutputStream::ZipOutputStream( StreamFile & outputStream )
+    : _outputStream( outputStream )
+    , _zStream( std::make_unique<z_stream_s>() )
+{
+    _headerPos = _outputStream.tell();
+
+    // The sizes will be updated by finish()
+    _outputStream.put32( 0 );
+    _outputStream.put32( 0 );
+    _outputStream.put16( FORMAT_VERSION_0 );
+    _outputStream.put16( 0 ); // Unused bytes
+
+    if ( _outputStream.fail() ) {
+        _zStream.reset();
+        setFail();
+
+        return;
+    }
+
+    const int ret = deflateInit( _zStream.get(), Z_DEFAULT_COMPRESSION );
+    if ( ret != Z_OK ) {
+        ERROR_LOG( "zlib error: " << ret )
+
+        _zStream.reset();
+        setFail();
+
+        return;
+    }
+
+    _inputBuffer.reserve( streamBufferSize );
+    _outputBuffer.resize( streamBufferSize );
+}
+
+Compression::ZipOutputStream::~ZipOutputStream()
+{
+    if ( _zStream ) {
+        deflateEnd( _zStream.get() );
+    }
+}
+
+void Compression::ZipOutputStream::putBE16( uint16_t v )
+{
+    put8( v >> 8 );
+    put8( v & 0xFF );
+}
+
+void Compression::ZipOutputStream::putLE16( uint16_t v )
+{
+    put8( v & 0xFF );
+    put8( v >> 8 );
+}
+
+void Compression::ZipOutputStream::putBE32( uint32_t v )
+{
+    put8( v >> 24 );
+    put8( ( v >> 16 ) & 0xFF );
+    put8( ( v >> 8 ) & 0xFF );
+    put8( v & 0xFF );
+}
+
+void Compression::ZipOutputStream::putLE32( uint32_t v )
+{
+    put8( v & 0xFF );
+    put8( ( v >> 8 ) & 0xFF );
+    put8( ( v >> 16 ) & 0xFF );
+    put8( v >> 24 );
+}
+
+void Compression::ZipOutputStream::putRaw( const void * ptr, size_t size )
+{
+    if ( fail() ) {
+        return;
+    }
+
+    const uint8_t * data = static_cast<const uint8_t *>( ptr );
+
+    _rawSize += size;
+
+    while ( size > 0 ) {
+        const size_t chunkSize = std::min( size, streamBufferSize - _inputBuffer.size() );
+
+        _inputBuffer.insert( _inputBuffer.end(), data, data + chunkSize );
+
+        data += chunkSize;
+        size -= chunkSize;
+
+        if ( _inputBuffer.size() == streamBufferSize && !deflateData( false ) ) {
+            return;
+        }
+    }
+}
+
+bool Compression::ZipOutputStream::finish()
+{
+    if ( fail() || !deflateData( true ) ) {
+        return false;
+    }
+
+    if ( _rawSize > std::numeric_limits<uint32_t>::max() || _zipSize > std::numeric_limits<uint32_t>::max() ) {
+        ERROR_LOG( "The size of the data is too large" )
+
+        setFail();
+
+        return false;
+    }
+
+    const size_t endPos = _outputStream.tell();
+
+    _outputStream.seek( _headerPos );
+    _outputStream.put32( static_cast<uint32_t>( _rawSize ) );
+    _outputStream.put32( static_cast<uint32_t>( _zipSize ) );
+    _outputStream.seek( endPos );
+
+    if ( _outputStream.fail() ) {
+        setFail();
+
+        return false;
+    }
+
+    return true;
+}
+
+void Compression::ZipOutputStream::put8( const uint8_t v )
+{
+    if ( fail() ) {
+        return;
+    }
+
+    ++_rawSize;
+
+    _inputBuffer.push_back( v );
+
+    if ( _inputBuffer.size() == streamBufferSize ) {
+        deflateData( false );
+    }
+}
+
+bool Compression::ZipOutputStream::deflateData( const bool finish )
+{
+    assert( _zStream );
+
+    _zStream->next_in = _inputBuffer.data();
+    _zStream->avail_in = static_cast<uInt>( _inputBuffer.size() );
+
+    const int flush = finish ? Z_FINISH : Z_NO_FLUSH;
+
+    int ret = Z_OK;
+
+    // Keep compressing while the output buffer is being filled up completely, since zlib may have more data to output
+    do {
+        _zStream->next_out = _outputBuffer.data();
+        _zStream->avail_out = static_cast<uInt>( _outputBuffer.size() );
+
+        ret = deflate( _zStream.get(), flush );
+        if ( ret == Z_STREAM_ERROR ) {
+            ERROR_LOG( "zlib error: " << ret )
+
+            setFail();
+
+            return false;
+        }
+
+        const size_t zipChunkSize = _outputBuffer.size() - _zStream->avail_out;
+
+        _outputStream.putRaw( _outputBuffer.data(), zipChunkSize );
+        if ( _outputStream.fail() ) {
+            setFail();
+
+            return false;
+        }
+
+        _zipSize += zipChunkSize;
+    } while ( _zStream->avail_out == 0 );
+
+    assert( _zStream->avail_in == 0 );
+
+    _inputBuffer.clear();
+
+    if ( finish && ret != Z_STREAM_END ) {
+        ERROR_LOG( "zlib error: " << ret )
+
+        setFail();
+
+        return false;
+    }
+
+    return true;
+}
+
 fheroes2::Image Compression::CreateImageFromZlib( int32_t width, int32_t height, const uint8_t * imageData, size_t imageSize, bool doubleLayer )
 {
     if ( imageData == nullptr || imageSize == 0 || width <= 0 || height <= 0 ) {
@@ -25,13 +25,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "image.h"
+#include "serialize.h"
 
-class IStreamBase;
-class OStreamBase;
-class IStreamBuf;
+struct z_stream_s;
 
 namespace Compression
 {
@@ -53,5 +53,102 @@ namespace Compression
     // true on success and false on error.
     bool zipStreamBuf( const IStreamBuf & inputStream, OStreamBase & outputStream );
 
+    // Stream that reads the zipped chunk (in the format used by zipStreamBuf()) from the given input stream and unzips it on the fly
+    // using fixed-size buffers, so the whole compressed or uncompressed data is never kept in memory. The input stream should not be
+    // used by anyone else while this stream is being read. If the header of the zipped chunk is invalid, then this stream is marked
+    // as failed right after construction.
+    class ZipInputStream final : public IStreamBase
+    {
+    public:
+        explicit ZipInputStream( IStreamBase & inputStream );
+
+        ZipInputStream( const ZipInputStream & ) = delete;
+
+        ~ZipInputStream() override;
+
+        ZipInputStream & operator=( const ZipInputStream & ) = delete;
+
+        void skip( size_t size ) override;
+
+        uint16_t getBE16() override;
+        uint16_t getLE16() override;
+        uint32_t getBE32() override;
+        uint32_t getLE32() override;
+
+        // If a zero size is specified, then all still unread data is returned
+        std::vector<uint8_t> getRaw( const size_t size ) override;
+
+    private:
+        IStreamBase & _inputStream;
+
+        std::unique_ptr<z_stream_s> _zStream;
+
+        std::vector<uint8_t> _inputBuffer;
+        std::vector<uint8_t> _outputBuffer;
+
+        // Range of the still unread data in the output buffer
+        size_t _outputPos{ 0 };
+        size_t _outputSize{ 0 };
+
+        // Amount of the uncompressed data that has not yet been read from this stream
+        size_t _rawSizeLeft{ 0 };
+        // Amount of the compressed data that has not yet been read from the input stream
+        size_t _zipSizeLeft{ 0 };
+
+        uint8_t get8() override;
+
+        // Reads the given amount of the uncompressed data to the given buffer, or just skips it if the buffer is nullptr.
+        // Returns true on success, otherwise marks this stream as failed and returns false.
+        bool read( uint8_t * data, size_t size );
+
+        bool fillOutputBuffer();
+    };
+
+    // Stream that zips the data written to it on the fly using fixed-size buffers and writes it to the given file as a zipped chunk
+    // (in the format used by zipStreamBuf()), so the whole compressed data is never kept in memory. The sizes in the chunk header are
+    // updated by the finish() method, which should be called after all the data has been written. The file should not be used by
+    // anyone else until then.
+    class ZipOutputStream final : public OStreamBase
+    {
+    public:
+        explicit ZipOutputStream( StreamFile & outputStream );
+
+        ZipOutputStream( const ZipOutputStream & ) = delete;
+
+        ~ZipOutputStream() override;
+
+        ZipOutputStream & operator=( const ZipOutputStream & ) = delete;
+
+        void putBE16( uint16_t v ) override;
+        void putLE16( uint16_t v ) override;
+        void putBE32( uint32_t v ) override;
+        void putLE32( uint32_t v ) override;
+
+        void putRaw( const void * ptr, size_t size ) override;
+
+        // Writes the rest of the compressed data to the file and updates the chunk header. Returns true on success and false on error.
+        bool finish();
+
+    private:
+        StreamFile & _outputStream;
+
+        std::unique_ptr<z_stream_s> _zStream;
+
+        // Data that has been written to this stream, but has not yet been compressed
+        std::vector<uint8_t> _inputBuffer;
+        std::vector<uint8_t> _outputBuffer;
+
+        size_t _headerPos{ 0 };
+
+        size_t _rawSize{ 0 };
+        size_t _zipSize{ 0 };
+
+        void put8( const uint8_t v ) override;
+
+        // Compresses the contents of the input buffer and writes the result to the file. If 'finish' is true, then all the pending
+        // compressed data is written as well. Returns true on success, otherwise marks this stream as failed and returns false.
+        bool deflateData( const bool finish );
+    };
+
     fheroes2::Image CreateImageFromZlib( int32_t width, int32_t height, const uint8_t * imageData, size_t imageSize, bool doubleLayer );
 }
@@ -22,11 +22,13 @@
  ***************************************************************************/
 
 #include <list>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
 
 #include "agg.h"
 #include "agg_file.h"
+#include "agg_image.h"
 #include "dir.h"
 #include "settings.h"
 #include "tools.h"
@@ -35,10 +37,15 @@ namespace
 {
     fheroes2::AGGFile heroes2_agg;
     fheroes2::AGGFile heroes2x_agg;
+
+    // AGG files can be read by the ICN prefetching thread as well as by the main thread
+    std::mutex aggMutex;
 }
 
 std::vector<uint8_t> AGG::getDataFromAggFile( const std::string & key, const bool ignoreExpansion )
 {
+    const std::scoped_lock<std::mutex> lock( aggMutex );
+
     if ( !ignoreExpansion && heroes2x_agg.isGood() ) {
         // Make sure that the below container is not const and not a reference
         // so returning it from the function will invoke a move constructor instead of copy constructor.
@@ -50,6 +57,17 @@ std::vector<uint8_t> AGG::getDataFromAggFile( const std::string & key, const boo
     return heroes2_agg.read( key );
 }
 
+bool AGG::isDataPresentInAggFile( const std::string & key )
+{
+    const std::scoped_lock<std::mutex> lock( aggMutex );
+
+    if ( heroes2x_agg.isGood() && heroes2x_agg.exists( key ) ) {
+        return true;
+    }
+
+    return heroes2_agg.exists( key );
+}
+
 AGG::AGGInitializer::AGGInitializer()
 {
     if ( init() ) {
@@ -59,6 +77,12 @@ AGG::AGGInitializer::AGGInitializer()
     throw std::logic_error( "No AGG data files found." );
 }
 
+AGG::AGGInitializer::~AGGInitializer()
+{
+    // ICN prefetching reads AGG files, so it has to be stopped while they are still available
+    fheroes2::AGG::stopICNPrefetching();
+}
+
 bool AGG::AGGInitializer::init()
 {
     const ListFiles aggFileNames = Settings::FindFiles( "data", ".agg", false );
@@ -36,7 +36,7 @@ namespace AGG
         AGGInitializer( const AGGInitializer & ) = delete;
         AGGInitializer & operator=( const AGGInitializer & ) = delete;
 
-        ~AGGInitializer() = default;
+        ~AGGInitializer();
 
         const std::string & getOriginalAGGFilePath() const
         {
@@ -56,4 +56,7 @@ namespace AGG
     };
 
     std::vector<uint8_t> getDataFromAggFile( const std::string & key, const bool ignoreExpansion );
+
+    // Returns true if non-empty data with the given key is present in any of the AGG files. This is much cheaper than reading the data.
+    bool isDataPresentInAggFile( const std::string & key );
 }
@@ -24,10 +24,15 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <initializer_list>
 #include <map>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -43,11 +48,13 @@
 #include "icn.h"
 #include "image.h"
 #include "image_tool.h"
+#include "logging.h"
 #include "math_base.h"
 #include "pal.h"
 #include "rand.h"
 #include "screen.h"
 #include "serialize.h"
+#include "thread.h"
 #include "til.h"
 #include "tools.h"
 #include "translations.h"
@@ -69,6 +76,37 @@ namespace
 
     std::map<int, std::vector<fheroes2::Sprite>> _icnVsScaledSprite;
 
+    // The sequence number of the last access to the images of each ICN.
+    std::vector<uint64_t> _icnLastAccess( ICN::LASTICN, 0 );
+    uint64_t _icnAccessCounter{ 0 };
+
+    // The depth of the screen images scope in which the images of each ICN were requested for the first time since they had been
+    // loaded or since the scope they belonged to had been closed. Depth 0 means that the images are used outside of any scope and
+    // are never released. A negative value means that the images do not belong to any open scope.
+    const int32_t noScreenImagesScope{ -1 };
+    std::vector<int32_t> _icnScreenImagesScope( ICN::LASTICN, noScreenImagesScope );
+    int32_t _screenImagesScopeDepth{ 0 };
+
+    // Only the images of large ICNs (such as battlefield or castle backgrounds, or the images scaled to the screen resolution) are
+    // released when their screen is closed. Small ICNs are cheap to keep and are usually shared by many screens.
+    const size_t largeIcnMemoryUsage{ 256 * 1024 };
+
+    // Large images of closed screens are kept in memory to be reused next time, but only as long as they fit into the memory budget:
+    // the least recently used ones are released first.
+    const size_t screenImagesMemoryBudget{ 2 * 1024 * 1024 };
+
+    size_t getImagesMemoryUsage( const std::vector<fheroes2::Sprite> & images )
+    {
+        size_t usage = 0;
+
+        for ( const fheroes2::Sprite & image : images ) {
+            // Both image layers are always allocated
+            usage += static_cast<size_t>( image.width() ) * static_cast<size_t>( image.height() ) * 2;
+        }
+
+        return usage;
+    }
+
     // Some resources are language dependent. These are mostly buttons with a text of them.
     // Once a user changes a language we have to update resources. To do this we need to clear the existing images.
 
@@ -540,17 +578,14 @@ namespace
         _icnVsSprite[id][assetIndex] = fheroes2::decodeICNSprite( data, dataEnd, header1 );
     }
 
-    // This function returns true if sprites were successfully loaded from AGG file.
-    // WARNING: this function must be called once - only in the beginning of `loadICN()` function.
-    bool readIcnFromAgg( const int id )
+    // Decodes the ICN from AGG file. Returns an empty vector if this ICN is not present in AGG file. This function does not access
+    // the storage of loaded images, so it can be called from any thread.
+    std::vector<fheroes2::Sprite> decodeIcnFromAgg( const int id )
     {
-        // If this assertion blows up then something wrong with your logic and you load resources more than once!
-        assert( _icnVsSprite[id].empty() );
-
         const std::vector<uint8_t> & body = ::AGG::getDataFromAggFile( ICN::getIcnFileName( id ), false );
 
         if ( body.empty() ) {
-            return false;
+            return {};
         }
 
         ROStreamBuf imageStream( body );
@@ -558,10 +593,10 @@ namespace
         const uint32_t count = imageStream.getLE16();
         const uint32_t blockSize = imageStream.getLE32();
         if ( count == 0 || blockSize == 0 ) {
-            return false;
+            return {};
         }
 
-        _icnVsSprite[id].resize( count );
+        std::vector<fheroes2::Sprite> sprites( count );
 
         for ( uint32_t i = 0; i < count; ++i ) {
             imageStream.seek( headerSize + i * 13 );
@@ -592,10 +627,146 @@ namespace
             const uint8_t * data = body.data() + headerSize + header1.offsetData;
             const uint8_t * dataEnd = data + dataSize;
 
-            _icnVsSprite[id][i] = fheroes2::decodeICNSprite( data, dataEnd, header1 );
+            sprites[i] = fheroes2::decodeICNSprite( data, dataEnd, header1 );
+        }
+
+        return sprites;
+    }
+
+    // The maximum number of ICNs which are queued for decoding or are decoded but not requested yet
+    const size_t maxPrefetchedIcns{ 64 };
+
+    // Decodes the requested ICNs from AGG file in a background thread
+    class AsyncICNDecoder final : public MultiThreading::AsyncManager
+    {
+    public:
+        void pushICN( const int icnId )
+        {
+            createWorker();
+
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            if ( icnId == _currentIcnId || _decodedIcns.count( icnId ) > 0 || std::find( _icnQueue.begin(), _icnQueue.end(), icnId ) != _icnQueue.end() ) {
+                return;
+            }
+
+            // Prefetching is only a hint, so the requests which do not fit into the limit are ignored
+            if ( _icnQueue.size() + _decodedIcns.size() >= maxPrefetchedIcns ) {
+                return;
+            }
+
+            _icnQueue.push_back( icnId );
+
+            notifyWorker();
+        }
+
+        // Returns the decoded images of the given ICN if it was requested to be decoded, otherwise returns an empty optional.
+        // If this ICN is being decoded right now, waits for the decoding to be completed.
+        std::optional<std::vector<fheroes2::Sprite>> takeICN( const int icnId )
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+
+            // If the decoding of this ICN has not started yet, then it is faster to decode it in the calling thread
+            if ( const auto iter = std::find( _icnQueue.begin(), _icnQueue.end(), icnId ); iter != _icnQueue.end() ) {
+                _icnQueue.erase( iter );
+
+                return {};
+            }
+
+            _decodingCompleted.wait( lock, [this, icnId]() { return _currentIcnId != icnId; } );
+
+            const auto iter = _decodedIcns.find( icnId );
+            if ( iter == _decodedIcns.end() ) {
+                return {};
+            }
+
+            std::vector<fheroes2::Sprite> sprites = std::move( iter->second );
+            _decodedIcns.erase( iter );
+
+            return sprites;
+        }
+
+        void clear()
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+
+            _icnQueue.clear();
+
+            _decodingCompleted.wait( lock, [this]() { return _currentIcnId == ICN::UNKNOWN; } );
+
+            _decodedIcns.clear();
+        }
+
+    private:
+        std::deque<int> _icnQueue;
+        std::map<int, std::vector<fheroes2::Sprite>> _decodedIcns;
+
+        // Id of the ICN being decoded by the worker thread, it is modified only by the worker thread while holding the _mutex
+        int _currentIcnId{ ICN::UNKNOWN };
+
+        std::condition_variable _decodingCompleted;
+
+        // This method is called by the worker thread and is protected by _mutex
+        bool prepareTask() override
+        {
+            if ( _icnQueue.empty() ) {
+                return false;
+            }
+
+            _currentIcnId = _icnQueue.front();
+            _icnQueue.pop_front();
+
+            return true;
+        }
+
+        // This method is called by the worker thread, but is not protected by _mutex
+        void executeTask() override
+        {
+            if ( _currentIcnId == ICN::UNKNOWN ) {
+                // Nothing to do.
+                return;
+            }
+
+            std::optional<std::vector<fheroes2::Sprite>> sprites;
+
+            try {
+                sprites = decodeIcnFromAgg( _currentIcnId );
+            }
+            catch ( ... ) {
+                // The decoding will be performed again by the main thread when this ICN is requested, and the error will be handled there
+            }
+
+            {
+                const std::scoped_lock<std::mutex> lock( _mutex );
+
+                if ( sprites ) {
+                    _decodedIcns.try_emplace( _currentIcnId, std::move( *sprites ) );
+                }
+
+                _currentIcnId = ICN::UNKNOWN;
+            }
+
+            _decodingCompleted.notify_all();
         }
+    };
+
+    AsyncICNDecoder asyncIcnDecoder;
 
-        return true;
+    // This function returns true if sprites were successfully loaded from AGG file.
+    // WARNING: this function must be called once - only in the beginning of `loadICN()` function.
+    bool readIcnFromAgg( const int id )
+    {
+        // If this assertion blows up then something wrong with your logic and you load resources more than once!
+        assert( _icnVsSprite[id].empty() );
+
+        std::optional<std::vector<fheroes2::Sprite>> sprites = asyncIcnDecoder.takeICN( id );
+        if ( !sprites ) {
+            sprites = decodeIcnFromAgg( id );
+        }
+
+        _icnVsSprite[id] = std::move( *sprites );
+
+        return !_icnVsSprite[id].empty();
     }
 
     // Helper function for processICN
@@ -1502,7 +1673,7 @@ namespace
         }
         case ICN::BUTTONS_NEW_GAME_MENU_GOOD: {
             // Set the size depending on whether PoL assets are present or not, in which case add 4 more for campaign buttons.
-            const bool isPoLPresent = !::AGG::getDataFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty();
+            const bool isPoLPresent = ::AGG::isDataPresentInAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ) );
             if ( isPoLPresent ) {
                 _icnVsSprite[id].resize( 28 );
             }
@@ -1854,7 +2025,7 @@ namespace
     {
         switch ( id ) {
         case ICN::BUTTONS_NEW_GAME_MENU_GOOD: {
-            const bool isPoLPresent = !::AGG::getDataFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty();
+            const bool isPoLPresent = ::AGG::isDataPresentInAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ) );
             if ( isPoLPresent ) {
                 _icnVsSprite[id].resize( 28 );
             }
@@ -2074,7 +2245,7 @@ namespace
     {
         switch ( id ) {
         case ICN::BUTTONS_NEW_GAME_MENU_GOOD: {
-            const bool isPoLPresent = !::AGG::getDataFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty();
+            const bool isPoLPresent = ::AGG::isDataPresentInAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ) );
             if ( isPoLPresent ) {
                 _icnVsSprite[id].resize( 28 );
             }
@@ -3188,7 +3359,7 @@ namespace
 
                 // Since we cannot access game settings from here we are checking an existence
                 // of one of POL resources as an indicator for this version.
-                if ( !::AGG::getDataFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty() ) {
+                if ( ::AGG::isDataPresentInAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ) ) ) {
                     fheroes2::Sprite editorIcon;
                     fheroes2::h2d::readImage( "main_menu_editor_icon.image", editorIcon );
 
@@ -5311,6 +5482,12 @@ namespace fheroes2::AGG
             return errorImage;
         }
 
+        _icnLastAccess[icnId] = ++_icnAccessCounter;
+
+        if ( _icnScreenImagesScope[icnId] < 0 ) {
+            _icnScreenImagesScope[icnId] = _screenImagesScopeDepth;
+        }
+
         if ( IsScalableICN( icnId ) ) {
             return GetScaledICN( icnId, index );
         }
@@ -5318,6 +5495,91 @@ namespace fheroes2::AGG
         return _icnVsSprite[icnId][index];
     }
 
+    void prefetchICN( const std::vector<int> & icnIds )
+    {
+        for ( const int icnId : icnIds ) {
+            // Only the images which are loaded from AGG file as is can be decoded in advance
+            if ( !IsValidICNId( icnId ) || icnId >= ICN::LAST_VALID_FILE_ICN || !_icnVsSprite[icnId].empty() || isLanguageDependentIcnId( icnId ) ) {
+                continue;
+            }
+
+            asyncIcnDecoder.pushICN( icnId );
+        }
+    }
+
+    void stopICNPrefetching()
+    {
+        asyncIcnDecoder.clear();
+        asyncIcnDecoder.stopWorker();
+    }
+
+    ScreenImagesScope::ScreenImagesScope()
+    {
+        ++_screenImagesScopeDepth;
+    }
+
+    ScreenImagesScope::~ScreenImagesScope()
+    {
+        assert( _screenImagesScopeDepth > 0 );
+
+        // The ICNs which were prefetched for the closed screen but never requested are not needed anymore
+        asyncIcnDecoder.clear();
+
+        std::vector<std::pair<uint64_t, int>> loadedIcns;
+        size_t memoryUsage = 0;
+
+        for ( int icnId = 0; icnId < ICN::LASTICN; ++icnId ) {
+            int32_t & scopeDepth = _icnScreenImagesScope[icnId];
+
+            // The images used by the screens which are still open must be kept
+            if ( scopeDepth >= 0 && scopeDepth < _screenImagesScopeDepth ) {
+                continue;
+            }
+
+            scopeDepth = noScreenImagesScope;
+
+            size_t icnMemoryUsage = getImagesMemoryUsage( _icnVsSprite[icnId] );
+
+            const auto scaledIter = _icnVsScaledSprite.find( icnId );
+            if ( scaledIter != _icnVsScaledSprite.end() ) {
+                icnMemoryUsage += getImagesMemoryUsage( scaledIter->second );
+            }
+
+            if ( icnMemoryUsage < largeIcnMemoryUsage ) {
+                continue;
+            }
+
+            loadedIcns.emplace_back( _icnLastAccess[icnId], icnId );
+            memoryUsage += icnMemoryUsage;
+        }
+
+        --_screenImagesScopeDepth;
+
+        // The most recently used images are released last
+        std::sort( loadedIcns.begin(), loadedIcns.end() );
+
+        size_t releasedIcnsCount = 0;
+
+        for ( auto iter = loadedIcns.begin(); iter != loadedIcns.end() && memoryUsage > screenImagesMemoryBudget; ++iter ) {
+            std::vector<fheroes2::Sprite> & images = _icnVsSprite[iter->second];
+
+            memoryUsage -= getImagesMemoryUsage( images );
+            images.clear();
+
+            const auto scaledIter = _icnVsScaledSprite.find( iter->second );
+            if ( scaledIter != _icnVsScaledSprite.end() ) {
+                memoryUsage -= getImagesMemoryUsage( scaledIter->second );
+                _icnVsScaledSprite.erase( scaledIter );
+            }
+
+            ++releasedIcnsCount;
+        }
+
+        DEBUG_LOG( DBG_GAME, DBG_TRACE,
+                   "screen images: " << loadedIcns.size() - releasedIcnsCount << " ICNs are kept in memory (" << memoryUsage << " bytes), " << releasedIcnsCount
+                                     << " ICNs were released" )
+    }
+
     uint32_t GetICNCount( int icnId )
     {
         if ( !IsValidICNId( icnId ) ) {
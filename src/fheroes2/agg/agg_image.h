@@ -21,6 +21,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 namespace fheroes2
 {
@@ -34,6 +35,31 @@ namespace fheroes2
         const Sprite & GetICN( int icnId, uint32_t index );
         uint32_t GetICNCount( int icnId );
 
+        // Starts decoding the given ICNs in a background thread, so that they are ready by the time they are requested using GetICN().
+        // Should be called before opening a game screen which uses these ICNs. If GetICN() requests an ICN that is still being decoded,
+        // it waits for the decoding to complete. The number of prefetched ICNs is limited, and the ICNs which are still not requested
+        // are discarded when a ScreenImagesScope is closed.
+        void prefetchICN( const std::vector<int> & icnIds );
+
+        // Stops the background thread used to decode ICNs and discards all the prefetched images.
+        void stopICNPrefetching();
+
+        // Images which are requested for the first time while an object of this class exists are considered to belong to a single
+        // game screen (such as the battlefield, the castle screen or the main menu). When the object is destroyed, the least recently
+        // used large images of the closed screens are released until the memory occupied by them fits into the budget. Scopes can be
+        // nested. An object of this class must be destroyed only after its screen has been closed, since the references to the released
+        // images become invalid.
+        class ScreenImagesScope
+        {
+        public:
+            ScreenImagesScope();
+            ScreenImagesScope( const ScreenImagesScope & ) = delete;
+
+            ~ScreenImagesScope();
+
+            ScreenImagesScope & operator=( const ScreenImagesScope & ) = delete;
+        };
+
         // shapeId could be 0, 1, 2 or 3 only
         const Image & GetTIL( int tilId, uint32_t index, uint32_t shapeId );
 
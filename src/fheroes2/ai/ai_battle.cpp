@@ -604,7 +604,8 @@ namespace
 
 AI::BattlePlanner & AI::BattlePlanner::Get()
 {
-    static BattlePlanner ai;
+    // The battle planner keeps per-battle state, so each thread running its own battle should use its own instance
+    thread_local BattlePlanner ai;
     return ai;
 }
 
@@ -46,6 +46,7 @@
 #include "difficulty.h"
 #include "direction.h"
 #include "game.h"
+#include "game_benchmark.h"
 #include "game_delays.h"
 #include "game_interface.h"
 #include "game_mode.h"
@@ -100,6 +101,11 @@ namespace
         else {
             const PlayerColorsSet humanColor = Players::HumanColors();
 
+            // There are no human players at all in the headless benchmark mode.
+            if ( humanColor == 0 ) {
+                return 0;
+            }
+
             assert( Color::Count( humanColor ) == 1 );
 
             const Player * player = Players::Get( static_cast<PlayerColor>( humanColor ) );
@@ -2261,7 +2267,7 @@ fheroes2::GameMode AI::HeroesMove( Heroes & hero )
             }
 
             // Render a frame only if there is a need to show one.
-            if ( Game::validateAnimationDelay( Game::MAPS_DELAY ) ) {
+            if ( !Benchmark::isHeadlessMode() && Game::validateAnimationDelay( Game::MAPS_DELAY ) ) {
                 // Update Adventure Map objects' animation.
                 Game::updateAdventureMapAnimationIndex();
 
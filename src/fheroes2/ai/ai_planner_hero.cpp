@@ -2822,6 +2822,9 @@ fheroes2::GameMode AI::Planner::HeroesTurn( VecHeroes & heroes, uint32_t & curre
                 _pathfinder.setMinimalArmyStrengthAdvantage( minStrengthAdvantage );
                 _pathfinder.setSpellPointsReserveRatio( spReserveRatio );
 
+                // Nothing changes on the map while the targets of the heroes are being evaluated, so build the pathfinder caches for all of them at once
+                _pathfinder.precacheHeroes( availableHeroes );
+
                 double maxPriority = 0;
 
                 for ( Heroes * hero : availableHeroes ) {
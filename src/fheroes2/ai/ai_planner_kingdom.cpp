@@ -45,6 +45,7 @@
 #include "game_interface.h"
 #include "game_mode.h"
 #include "game_over.h"
+#include "game_turn_profiler.h"
 #include "ground.h"
 #include "heroes.h"
 #include "heroes_recruits.h"
@@ -60,6 +61,7 @@
 #include "route.h"
 #include "skill.h"
 #include "spell.h"
+#include "thread.h"
 #include "world.h"
 #include "world_pathfinding.h"
 #include "world_regions.h"
@@ -267,6 +269,88 @@ namespace
 
         return {};
     }
+
+    // The number of map rows analyzed as a single task at the beginning of the AI kingdom's turn
+    const int32_t mapScanAreaHeight = 16;
+
+    struct MapScanResult
+    {
+        std::vector<std::pair<int32_t, MP2::MapObjectType>> actionObjects;
+        std::vector<AI::EnemyArmy> enemyArmies;
+        std::vector<AI::RegionStats> regions;
+    };
+
+    // Analyzes the tiles in the range [begin, end) visible to the kingdom of the given color. This function only reads
+    // the state of the world, so it can be executed in parallel for different parts of the map.
+    MapScanResult scanMapArea( const int32_t begin, const int32_t end, const PlayerColor myColor, const bool isUnderViewSpell )
+    {
+        MapScanResult result;
+        result.regions.resize( world.getRegionCount() );
+
+        for ( int32_t idx = begin; idx < end; ++idx ) {
+            const Maps::Tile & tile = world.getTile( idx );
+            MP2::MapObjectType objectType = tile.getMainObjectType();
+
+            const uint32_t regionID = tile.GetRegion();
+            if ( regionID >= result.regions.size() ) {
+                assert( 0 );
+                continue;
+            }
+
+            AI::RegionStats & stats = result.regions[regionID];
+            if ( !isUnderViewSpell && tile.isFog( myColor ) ) {
+                continue;
+            }
+
+            if ( !MP2::isInGameActionObject( objectType ) ) {
+                continue;
+            }
+
+            result.actionObjects.emplace_back( idx, objectType );
+
+            if ( objectType == MP2::OBJ_HERO ) {
+                const Heroes * hero = tile.getHero();
+                assert( hero != nullptr );
+
+                if ( hero->GetColor() == myColor && !hero->Modes( Heroes::PATROL ) ) {
+                    ++stats.friendlyHeroes;
+
+                    const int wisdomLevel = hero->GetLevelSkill( Skill::Secondary::WISDOM );
+                    if ( wisdomLevel + 2 > stats.spellLevel ) {
+                        stats.spellLevel = wisdomLevel + 2;
+                    }
+                }
+
+                // This hero can be in a castle
+                objectType = tile.getMainObjectType( false );
+            }
+
+            if ( objectType == MP2::OBJ_CASTLE ) {
+                const Castle * castle = world.getCastleEntrance( Maps::GetPoint( idx ) );
+                assert( castle != nullptr );
+
+                if ( castle->isFriends( myColor ) ) {
+                    ++stats.friendlyCastles;
+                }
+                else if ( castle->GetColor() != PlayerColor::NONE ) {
+                    ++stats.enemyCastles;
+                }
+            }
+
+            const auto enemyArmy = getEnemyArmyOnTile( myColor, tile );
+            if ( enemyArmy ) {
+                assert( enemyArmy->index == idx );
+
+                result.enemyArmies.push_back( *enemyArmy );
+
+                if ( stats.highestThreat < enemyArmy->strength ) {
+                    stats.highestThreat = enemyArmy->strength;
+                }
+            }
+        }
+
+        return result;
+    }
 }
 
 bool AI::Planner::recruitHero( Castle & castle, bool buyArmy )
@@ -712,70 +796,44 @@ fheroes2::GameMode AI::Planner::KingdomTurn( Kingdom & kingdom )
         return true;
     }();
 
-    const int mapSize = world.w() * world.h();
-
-    for ( int idx = 0; idx < mapSize; ++idx ) {
-        const Maps::Tile & tile = world.getTile( idx );
-        MP2::MapObjectType objectType = tile.getMainObjectType();
-
-        const uint32_t regionID = tile.GetRegion();
-        if ( regionID >= _regions.size() ) {
-            assert( 0 );
-            continue;
-        }
-
-        RegionStats & stats = _regions[regionID];
-        if ( !isUnderViewSpell && tile.isFog( myColor ) ) {
-            continue;
-        }
-
-        if ( !MP2::isInGameActionObject( objectType ) ) {
-            continue;
-        }
+    {
+        // Analysis of the visible part of the map is read-only, so different parts of the map are analyzed concurrently. The results are then merged
+        // in the order of tiles, so they do not depend on the number of threads used.
+        const int32_t mapSize = world.w() * world.h();
+        const int32_t areaSize = world.w() * mapScanAreaHeight;
 
-        if ( const auto [dummy, inserted] = _mapActionObjects.try_emplace( idx, objectType ); !inserted ) {
-            assert( 0 );
-        }
+        std::vector<MapScanResult> scanResults( ( mapSize + areaSize - 1 ) / areaSize );
 
-        if ( objectType == MP2::OBJ_HERO ) {
-            const Heroes * hero = tile.getHero();
-            assert( hero != nullptr );
+        MultiThreading::parallelFor( scanResults.size(), [&scanResults, myColor, isUnderViewSpell, mapSize, areaSize]( const size_t idx ) {
+            const int32_t begin = static_cast<int32_t>( idx ) * areaSize;
 
-            if ( hero->GetColor() == myColor && !hero->Modes( Heroes::PATROL ) ) {
-                ++stats.friendlyHeroes;
+            scanResults[idx] = scanMapArea( begin, std::min( begin + areaSize, mapSize ), myColor, isUnderViewSpell );
+        } );
 
-                const int wisdomLevel = hero->GetLevelSkill( Skill::Secondary::WISDOM );
-                if ( wisdomLevel + 2 > stats.spellLevel ) {
-                    stats.spellLevel = wisdomLevel + 2;
+        for ( const MapScanResult & scanResult : scanResults ) {
+            for ( const auto & [idx, objectType] : scanResult.actionObjects ) {
+                if ( const auto [dummy, inserted] = _mapActionObjects.try_emplace( idx, objectType ); !inserted ) {
+                    assert( 0 );
                 }
             }
 
-            // This hero can be in a castle
-            objectType = tile.getMainObjectType( false );
-        }
-
-        if ( objectType == MP2::OBJ_CASTLE ) {
-            const Castle * castle = world.getCastleEntrance( Maps::GetPoint( idx ) );
-            assert( castle != nullptr );
-
-            if ( castle->isFriends( myColor ) ) {
-                ++stats.friendlyCastles;
-            }
-            else if ( castle->GetColor() != PlayerColor::NONE ) {
-                ++stats.enemyCastles;
+            for ( const AI::EnemyArmy & enemyArmy : scanResult.enemyArmies ) {
+                if ( const auto [dummy, inserted] = _enemyArmies.try_emplace( enemyArmy.index, enemyArmy ); !inserted ) {
+                    assert( 0 );
+                }
             }
-        }
 
-        const auto enemyArmy = getEnemyArmyOnTile( myColor, tile );
-        if ( enemyArmy ) {
-            assert( enemyArmy->index == idx );
+            assert( scanResult.regions.size() == _regions.size() );
 
-            if ( const auto [dummy, inserted] = _enemyArmies.try_emplace( idx, *enemyArmy ); !inserted ) {
-                assert( 0 );
-            }
+            for ( size_t regionID = 0; regionID < _regions.size(); ++regionID ) {
+                const AI::RegionStats & areaStats = scanResult.regions[regionID];
+                AI::RegionStats & stats = _regions[regionID];
 
-            if ( stats.highestThreat < enemyArmy->strength ) {
-                stats.highestThreat = enemyArmy->strength;
+                stats.highestThreat = std::max( stats.highestThreat, areaStats.highestThreat );
+                stats.friendlyHeroes += areaStats.friendlyHeroes;
+                stats.friendlyCastles += areaStats.friendlyCastles;
+                stats.enemyCastles += areaStats.enemyCastles;
+                stats.spellLevel = std::max( stats.spellLevel, areaStats.spellLevel );
             }
         }
     }
@@ -851,7 +909,11 @@ fheroes2::GameMode AI::Planner::KingdomTurn( Kingdom & kingdom )
             = ( currentProgressValue == 1 ) ? std::min( static_cast<uint32_t>( heroes.size() ) * 2U + 1U, 8U ) : std::min( currentProgressValue + 2U, 9U );
 
         bool moreTaskForHeroes = false;
-        const fheroes2::GameMode gameState = HeroesTurn( heroes, currentProgressValue, endProgressValue, moreTaskForHeroes );
+        const fheroes2::GameMode gameState = [this, &heroes, &currentProgressValue, endProgressValue, &moreTaskForHeroes]() {
+            const TurnProfiler::PhaseTimer phaseTimer( TurnProfiler::Phase::HEROES );
+
+            return HeroesTurn( heroes, currentProgressValue, endProgressValue, moreTaskForHeroes );
+        }();
         if ( gameState != fheroes2::GameMode::END_TURN ) {
             return gameState;
         }
@@ -900,12 +962,16 @@ fheroes2::GameMode AI::Planner::KingdomTurn( Kingdom & kingdom )
     }
 
     // Perform the castle development
-    for ( const AICastle & entry : sortedCastleList ) {
-        if ( entry.castle == nullptr ) {
-            continue;
-        }
+    {
+        const TurnProfiler::PhaseTimer phaseTimer( TurnProfiler::Phase::CASTLES );
 
-        CastleTurn( *entry.castle, entry.underThreat );
+        for ( const AICastle & entry : sortedCastleList ) {
+            if ( entry.castle == nullptr ) {
+                continue;
+            }
+
+            CastleTurn( *entry.castle, entry.underThreat );
+        }
     }
 
     // For heroes in castles or towns, transfer their slowest troops to the garrison at the end of the turn to try to get a movement bonus on the next turn
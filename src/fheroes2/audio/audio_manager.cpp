@@ -28,6 +28,7 @@
 #include <cstddef>
 #include <cstdlib>
 #include <deque>
+#include <iterator>
 #include <list>
 #include <mutex>
 #include <optional>
@@ -253,6 +254,7 @@ namespace
 
     // Returns the ID of the channel occupied by the sound being played, or a negative value (-1) in case of failure.
     int PlaySoundImpl( const int m82 );
+    void preloadSoundImpl( const int m82 );
     void PlayMusicImpl( const int trackId, const MusicSource musicType, const Music::PlaybackMode playbackMode );
     void playLoopSoundsImpl( std::map<M82::SoundType, std::vector<AudioManager::AudioLoopEffectInfo>> soundEffects, const bool is3DAudioEnabled );
 
@@ -295,6 +297,18 @@ namespace
             notifyWorker();
         }
 
+        void pushPreloadSounds( const std::vector<int> & m82Sounds )
+        {
+            createWorker();
+
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            // Each sound is preloaded by a separate task so that other tasks and the main thread do not wait for the whole list.
+            std::copy_if( m82Sounds.begin(), m82Sounds.end(), std::back_inserter( _soundsToPreload ), []( const int m82 ) { return m82 != M82::UNKNOWN; } );
+
+            notifyWorker();
+        }
+
         void removeMusicTask()
         {
             const std::scoped_lock<std::mutex> lock( _mutex );
@@ -341,6 +355,7 @@ namespace
             _musicTask.reset();
             _soundTasks.clear();
             _loopSoundTask.reset();
+            _soundsToPreload.clear();
 
             _taskToExecute = TaskType::None;
         }
@@ -357,7 +372,8 @@ namespace
             None,
             PlayMusic,
             PlaySound,
-            PlayLoopSound
+            PlayLoopSound,
+            PreloadSound
         };
 
         struct MusicTask
@@ -408,10 +424,12 @@ namespace
         std::optional<MusicTask> _musicTask;
         std::deque<SoundTask> _soundTasks;
         std::optional<LoopSoundTask> _loopSoundTask;
+        std::deque<int> _soundsToPreload;
 
         MusicTask _currentMusicTask;
         SoundTask _currentSoundTask;
         LoopSoundTask _currentLoopSoundTask;
+        int _currentSoundToPreload{ M82::UNKNOWN };
 
         std::atomic<TaskType> _taskToExecute{ TaskType::None };
 
@@ -447,6 +465,16 @@ namespace
                 return true;
             }
 
+            // Preloading has the lowest priority so as not to delay the playback of anything
+            if ( !_soundsToPreload.empty() ) {
+                _currentSoundToPreload = _soundsToPreload.front();
+                _soundsToPreload.pop_front();
+
+                _taskToExecute = TaskType::PreloadSound;
+
+                return true;
+            }
+
             _taskToExecute = TaskType::None;
 
             return false;
@@ -473,6 +501,9 @@ namespace
             case TaskType::PlayLoopSound:
                 playLoopSoundsImpl( std::move( _currentLoopSoundTask.soundEffects ), _currentLoopSoundTask.is3DAudioEnabled );
                 return;
+            case TaskType::PreloadSound:
+                preloadSoundImpl( _currentSoundToPreload );
+                return;
             default:
                 // How is it even possible? Did you add a new task?
                 assert( 0 );
@@ -518,7 +549,19 @@ namespace
             return -1;
         }
 
-        return Mixer::Play( v.data(), static_cast<uint32_t>( v.size() ), false );
+        return Mixer::Play( static_cast<uint64_t>( m82 ), v.data(), static_cast<uint32_t>( v.size() ), false );
+    }
+
+    void preloadSoundImpl( const int m82 )
+    {
+        const std::scoped_lock<std::recursive_mutex> lock( g_asyncSoundManager.resourceMutex() );
+
+        const std::vector<uint8_t> & v = GetWAV( m82 );
+        if ( v.empty() ) {
+            return;
+        }
+
+        Mixer::preload( static_cast<uint64_t>( m82 ), v.data(), static_cast<uint32_t>( v.size() ) );
     }
 
     uint64_t getMusicUID( const int trackId, const MusicSource musicType )
@@ -761,8 +804,8 @@ namespace
 
                 assert( is3DAudioEnabled || effectInfo.angle == 0 );
 
-                const int channelId
-                    = Mixer::Play( audioData.data(), static_cast<uint32_t>( audioData.size() ), true, std::pair{ effectInfo.angle, effectInfo.distance } );
+                const int channelId = Mixer::Play( static_cast<uint64_t>( soundType ), audioData.data(), static_cast<uint32_t>( audioData.size() ), true,
+                                                   std::pair{ effectInfo.angle, effectInfo.distance } );
                 if ( channelId < 0 ) {
                     // Unable to play this sound.
                     continue;
@@ -869,6 +912,15 @@ namespace AudioManager
         g_asyncSoundManager.pushSound( m82 );
     }
 
+    void preloadSoundsAsync( const std::vector<int> & m82Sounds )
+    {
+        if ( !Audio::isValid() ) {
+            return;
+        }
+
+        g_asyncSoundManager.pushPreloadSounds( m82Sounds );
+    }
+
     bool isExternalMusicFileAvailable( const int trackId )
     {
         return !getExternalMusicFile( trackId ).empty();
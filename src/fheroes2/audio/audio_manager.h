@@ -97,6 +97,9 @@ namespace AudioManager
     int PlaySound( const int m82 );
     void PlaySoundAsync( const int m82 );
 
+    // Decodes the given sounds in the background, so there will be no delay when they are played for the first time.
+    void preloadSoundsAsync( const std::vector<int> & m82Sounds );
+
     // Returns true if an external music file is available for the music track with the specified ID, otherwise returns false.
     bool isExternalMusicFileAvailable( const int trackId );
 
@@ -432,15 +432,12 @@ void Battle::Arena::ApplyAction( Command & cmd )
 
 void Battle::Arena::ApplyActionSpellCast( Command & cmd )
 {
-    const auto checkParameters = []( const Spell & spell, const HeroBase * commander ) {
+    const auto checkParameters = [this]( const Spell & spell, const HeroBase * commander ) {
         if ( !spell.isCombat() ) {
             return false;
         }
 
-        const Arena * arena = GetArena();
-        assert( arena != nullptr );
-
-        if ( arena->isDisableCastSpell( spell ) ) {
+        if ( isDisableCastSpell( spell ) ) {
             return false;
         }
 
@@ -808,15 +805,12 @@ void Battle::Arena::ApplyActionRetreat( const Command & /* cmd */ )
 
 void Battle::Arena::ApplyActionSurrender( const Command & /* cmd */ )
 {
-    const auto checkPreconditions = []( const Funds & cost ) {
-        const Arena * arena = GetArena();
-        assert( arena != nullptr );
-
-        if ( !arena->CanSurrenderOpponent( arena->GetCurrentColor() ) ) {
+    const auto checkPreconditions = [this]( const Funds & cost ) {
+        if ( !CanSurrenderOpponent( GetCurrentColor() ) ) {
             return false;
         }
 
-        if ( !world.GetKingdom( arena->GetCurrentColor() ).AllowPayment( cost ) ) {
+        if ( !world.GetKingdom( GetCurrentColor() ).AllowPayment( cost ) ) {
             return false;
         }
 
@@ -1272,60 +1266,53 @@ void Battle::Arena::ApplyActionCatapult( Command & cmd )
         return ( damage <= getCastleDefenseStructureCondition( target, SiegeWeaponType::Catapult ) );
     };
 
-    uint32_t shots = cmd.GetNextValue();
+    const CastleDefenseStructure target = static_cast<CastleDefenseStructure>( cmd.GetNextValue() );
+    const int damage = cmd.GetNextValue();
+    const bool hit = ( cmd.GetNextValue() != 0 );
 
-    while ( shots-- ) {
-        const CastleDefenseStructure target = static_cast<CastleDefenseStructure>( cmd.GetNextValue() );
-        const int damage = cmd.GetNextValue();
-        const bool hit = ( cmd.GetNextValue() != 0 );
-
-        if ( target == CastleDefenseStructure::NONE ) {
-            continue;
-        }
+    if ( target == CastleDefenseStructure::NONE ) {
+        return;
+    }
 
-        using TargetUnderlyingType = std::underlying_type_t<decltype( target )>;
+    using TargetUnderlyingType = std::underlying_type_t<decltype( target )>;
 
-        if ( !checkParameters( target, damage ) ) {
-            ERROR_LOG( "Invalid parameters: "
-                       << "target: " << static_cast<TargetUnderlyingType>( target ) << ", damage: " << damage << ", hit: " << ( hit ? "yes" : "no" ) )
+    if ( !checkParameters( target, damage ) ) {
+        ERROR_LOG( "Invalid parameters: "
+                   << "target: " << static_cast<TargetUnderlyingType>( target ) << ", damage: " << damage << ", hit: " << ( hit ? "yes" : "no" ) )
 
 #ifdef WITH_DEBUG
-            assert( 0 );
+        assert( 0 );
 #endif
 
-            return;
-        }
+        return;
+    }
 
-        DEBUG_LOG( DBG_BATTLE, DBG_TRACE, "target: " << static_cast<TargetUnderlyingType>( target ) << ", damage: " << damage << ", hit: " << ( hit ? "yes" : "no" ) )
+    DEBUG_LOG( DBG_BATTLE, DBG_TRACE, "target: " << static_cast<TargetUnderlyingType>( target ) << ", damage: " << damage << ", hit: " << ( hit ? "yes" : "no" ) )
 
-        if ( _interface ) {
-            _interface->RedrawActionCatapultPart1( target, hit );
-        }
+    if ( _interface ) {
+        _interface->RedrawActionCatapultPart1( target, hit );
+    }
 
-        if ( !hit ) {
-            continue;
-        }
+    if ( !hit ) {
+        return;
+    }
 
-        applyDamageToCastleDefenseStructure( target, damage );
+    applyDamageToCastleDefenseStructure( target, damage );
 
-        if ( _interface ) {
-            // Continue animating the smoke cloud after changing the "health" of the building.
-            _interface->RedrawActionCatapultPart2( target );
-        }
+    if ( _interface ) {
+        // Continue animating the smoke cloud after changing the "health" of the building.
+        _interface->RedrawActionCatapultPart2( target );
     }
 }
 
 void Battle::Arena::ApplyActionToggleAutoCombat( Command & cmd )
 {
-    const auto checkParameters = []( const PlayerColor color ) {
-        const Arena * arena = GetArena();
-        assert( arena != nullptr );
-
-        if ( color != arena->getAttackingArmyColor() && color != arena->getDefendingArmyColor() ) {
+    const auto checkParameters = [this]( const PlayerColor color ) {
+        if ( color != getAttackingArmyColor() && color != getDefendingArmyColor() ) {
             return false;
         }
 
-        if ( arena->getForce( color ).GetControl() & CONTROL_AI ) {
+        if ( getForce( color ).GetControl() & CONTROL_AI ) {
             return false;
         }
 
@@ -1392,15 +1379,12 @@ void Battle::Arena::ApplyActionQuickCombat( const Command & /* cmd */ )
 
 void Battle::Arena::_applyActionSpellSummonElemental( const Spell & spell )
 {
-    const auto checkPreconditions = []() {
-        const Arena * arena = GetArena();
-        assert( arena != nullptr );
-
-        if ( arena->GetCurrentCommander() == nullptr ) {
+    const auto checkPreconditions = [this]() {
+        if ( GetCurrentCommander() == nullptr ) {
             return false;
         }
 
-        const int32_t idx = arena->GetFreePositionNearHero( arena->GetCurrentColor() );
+        const int32_t idx = GetFreePositionNearHero( GetCurrentColor() );
 
         return Board::isValidIndex( idx );
     };
@@ -1480,7 +1464,7 @@ void Battle::Arena::_applyActionSpellDefaults( Command & cmd, const Spell & spel
 
 void Battle::Arena::_applyActionSpellTeleport( Command & cmd )
 {
-    const auto checkParameters = []( const Unit * unit, const Cell * cell ) {
+    const auto checkParameters = [this]( const Unit * unit, const Cell * cell ) {
         if ( unit == nullptr || !unit->isValid() ) {
             return false;
         }
@@ -1489,10 +1473,7 @@ void Battle::Arena::_applyActionSpellTeleport( Command & cmd )
             return false;
         }
 
-        const Arena * arena = GetArena();
-        assert( arena != nullptr );
-
-        return arena->GetCurrentCommander() != nullptr;
+        return GetCurrentCommander() != nullptr;
     };
 
     const int32_t src = cmd.GetNextValue();
@@ -1608,15 +1589,12 @@ void Battle::Arena::_applyActionSpellEarthquake()
 
 void Battle::Arena::_applyActionSpellMirrorImage( Command & cmd )
 {
-    const auto checkParameters = []( const Unit * unit ) {
+    const auto checkParameters = [this]( const Unit * unit ) {
         if ( unit == nullptr || !unit->isValid() ) {
             return false;
         }
 
-        const Arena * arena = GetArena();
-        assert( arena != nullptr );
-
-        return arena->GetCurrentCommander() != nullptr;
+        return GetCurrentCommander() != nullptr;
     };
 
     const int32_t targetUnitCellIndex = cmd.GetNextValue();
@@ -71,7 +71,9 @@
 
 namespace
 {
-    Battle::Arena * arena = nullptr;
+    // Every thread can run its own battle independently of the others (for example, when battles are simulated in
+    // parallel), so the current arena is tracked separately for each thread.
+    thread_local Battle::Arena * arena = nullptr;
 
     template <typename T>
     Battle::Unit * getLastResurrectableUnitFromGraveyardTmpl( const Battle::Graveyard & graveyard, const HeroBase * commander, const int32_t index, const T & spells )
@@ -458,6 +460,210 @@ Battle::Arena::~Arena()
     arena = nullptr;
 }
 
+struct Battle::Arena::Snapshot::Data
+{
+    struct CommanderState
+    {
+        uint32_t spellPoints{ 0 };
+        bool isSpellCasted{ false };
+    };
+
+    // States of all units including the castle towers
+    std::vector<std::pair<Unit *, Unit::State>> units;
+
+    std::vector<Unit *> attackingUnits;
+    std::vector<Unit *> defendingUnits;
+    std::vector<Unit *> orderOfUnits;
+
+    // Objects and units of the board cells
+    std::vector<std::pair<int, Unit *>> cells;
+
+    std::map<int32_t, std::vector<Unit *>> graveyard;
+
+    std::array<bool, 3> isTowerValid{};
+    bool isBridgeDestroyed{ false };
+    bool isBridgeDown{ false };
+
+    CommanderState attackingCommander;
+    CommanderState defendingCommander;
+
+    Result battleResult;
+    SpellStorage usedSpells;
+
+    Unit * currentUnit{ nullptr };
+    PlayerColor lastActiveUnitArmyColor{ PlayerColor::UNUSED };
+    uint32_t turnNumber{ 0 };
+    PlayerColorsSet autoCombatColors{ 0 };
+
+    Rand::PCG32 randomGenerator;
+    uint32_t nextUnitUID{ 0 };
+};
+
+Battle::Arena::InterfaceSuspender::InterfaceSuspender( Arena & arena )
+    : _arena( arena )
+    , _interface( std::move( arena._interface ) )
+{
+    // Do nothing.
+}
+
+Battle::Arena::InterfaceSuspender::~InterfaceSuspender()
+{
+    assert( _arena._interface == nullptr );
+
+    _arena._interface = std::move( _interface );
+}
+
+Battle::Arena::Snapshot Battle::Arena::createSnapshot() const
+{
+    auto data = std::make_shared<Snapshot::Data>();
+
+    data->units.reserve( _attackingArmy->size() + _defendingArmy->size() + _towers.size() );
+
+    for ( const Force * force : { _attackingArmy.get(), _defendingArmy.get() } ) {
+        for ( Unit * unit : *force ) {
+            assert( unit != nullptr );
+
+            data->units.emplace_back( unit, unit->getState() );
+        }
+    }
+
+    for ( size_t i = 0; i < _towers.size(); ++i ) {
+        if ( _towers[i] == nullptr ) {
+            continue;
+        }
+
+        data->units.emplace_back( _towers[i].get(), _towers[i]->getState() );
+        data->isTowerValid[i] = _towers[i]->isValid();
+    }
+
+    data->attackingUnits.assign( _attackingArmy->begin(), _attackingArmy->end() );
+    data->defendingUnits.assign( _defendingArmy->begin(), _defendingArmy->end() );
+
+    if ( _orderOfUnits ) {
+        data->orderOfUnits.assign( _orderOfUnits->begin(), _orderOfUnits->end() );
+    }
+
+    data->cells.reserve( board.size() );
+
+    for ( const Cell & cell : board ) {
+        data->cells.emplace_back( cell.GetObject(), const_cast<Unit *>( cell.GetUnit() ) );
+    }
+
+    data->graveyard = _graveyard;
+
+    if ( _bridge ) {
+        data->isBridgeDestroyed = _bridge->isDestroyed();
+        data->isBridgeDown = _bridge->isDown();
+    }
+
+    const auto getCommanderState = []( const HeroBase * commander ) {
+        Snapshot::Data::CommanderState state;
+
+        if ( commander != nullptr ) {
+            state.spellPoints = commander->GetSpellPoints();
+            state.isSpellCasted = commander->Modes( Heroes::SPELLCASTED );
+        }
+
+        return state;
+    };
+
+    data->attackingCommander = getCommanderState( _attackingArmy->GetCommander() );
+    data->defendingCommander = getCommanderState( _defendingArmy->GetCommander() );
+
+    data->battleResult = _battleResult;
+    data->usedSpells = _usedSpells;
+
+    data->currentUnit = _currentUnit;
+    data->lastActiveUnitArmyColor = _lastActiveUnitArmyColor;
+    data->turnNumber = _turnNumber;
+    data->autoCombatColors = _autoCombatColors;
+
+    data->randomGenerator = _randomGenerator;
+    data->nextUnitUID = _uidGenerator.getNextUnique();
+
+    Snapshot snapshot;
+    snapshot._data = std::move( data );
+
+    return snapshot;
+}
+
+void Battle::Arena::restoreSnapshot( const Snapshot & snapshot )
+{
+    assert( snapshot._data != nullptr );
+
+    const Snapshot::Data & data = *snapshot._data;
+
+    // Units that were created after the snapshot was taken (for example, elementals or mirror images) should be destroyed
+    const auto restoreForce = []( Force & force, const std::vector<Unit *> & units ) {
+        for ( Unit * unit : force ) {
+            if ( std::find( units.begin(), units.end(), unit ) == units.end() ) {
+                delete unit;
+            }
+        }
+
+        force.assign( units.begin(), units.end() );
+    };
+
+    restoreForce( *_attackingArmy, data.attackingUnits );
+    restoreForce( *_defendingArmy, data.defendingUnits );
+
+    if ( _orderOfUnits ) {
+        _orderOfUnits->assign( data.orderOfUnits.begin(), data.orderOfUnits.end() );
+    }
+
+    for ( const auto & [unit, state] : data.units ) {
+        unit->setState( state );
+    }
+
+    for ( size_t i = 0; i < _towers.size(); ++i ) {
+        if ( _towers[i] ) {
+            _towers[i]->setValid( data.isTowerValid[i] );
+        }
+    }
+
+    assert( data.cells.size() == board.size() );
+
+    for ( size_t i = 0; i < board.size(); ++i ) {
+        board[i].SetObject( data.cells[i].first );
+        board[i].SetUnit( data.cells[i].second );
+    }
+
+    static_cast<std::map<int32_t, std::vector<Unit *>> &>( _graveyard ) = data.graveyard;
+
+    if ( _bridge ) {
+        _bridge->setState( data.isBridgeDestroyed, data.isBridgeDown );
+    }
+
+    const auto restoreCommanderState = []( HeroBase * commander, const Snapshot::Data::CommanderState & state ) {
+        if ( commander == nullptr ) {
+            return;
+        }
+
+        commander->SetSpellPoints( state.spellPoints );
+
+        if ( state.isSpellCasted ) {
+            commander->SetModes( Heroes::SPELLCASTED );
+        }
+        else {
+            commander->ResetModes( Heroes::SPELLCASTED );
+        }
+    };
+
+    restoreCommanderState( _attackingArmy->GetCommander(), data.attackingCommander );
+    restoreCommanderState( _defendingArmy->GetCommander(), data.defendingCommander );
+
+    _battleResult = data.battleResult;
+    _usedSpells = data.usedSpells;
+
+    _currentUnit = data.currentUnit;
+    _lastActiveUnitArmyColor = data.lastActiveUnitArmyColor;
+    _turnNumber = data.turnNumber;
+    _autoCombatColors = data.autoCombatColors;
+
+    _randomGenerator = data.randomGenerator;
+    _uidGenerator.setNextUnique( data.nextUnitUID );
+}
+
 void Battle::Arena::UnitTurn( const Units & orderHistory )
 {
     assert( _currentUnit && _currentUnit->isValid() );
@@ -476,7 +682,8 @@ void Battle::Arena::UnitTurn( const Units & orderHistory )
         // There should be no dead units on the board at the beginning of each iteration
         assert( std::all_of( board.begin(), board.end(), []( const Cell & cell ) { return ( cell.GetUnit() == nullptr || cell.GetUnit()->isValid() ); } ) );
 
-        Actions actions;
+        Actions & actions = _actions;
+        actions.clear();
 
         if ( _interface ) {
             _interface->getPendingActions( actions );
@@ -519,9 +726,9 @@ void Battle::Arena::UnitTurn( const Units & orderHistory )
                                                     []( const uint64_t stream, const Command & cmd ) { return cmd.updatePCG32Stream( stream ); } );
         _randomGenerator.setStream( newStream );
 
-        while ( !actions.empty() ) {
-            ApplyAction( actions.front() );
-            actions.pop_front();
+        // New actions can be added to the end of the buffer while applying the existing ones
+        for ( size_t i = 0; i < actions.size(); ++i ) {
+            ApplyAction( actions[i] );
 
             board.removeDeadUnits();
 
@@ -736,9 +943,9 @@ void Battle::Arena::CatapultAction()
         }
     }
 
-    Command cmd( Command::CATAPULT );
-
-    cmd << shots;
+    // All the shots are determined first and only then applied, each shot is a separate command
+    Actions shotActions;
+    shotActions.reserve( shots );
 
     while ( shots-- ) {
         const CastleDefenseStructure target = Catapult::GetTarget( stateOfCatapultTargets, _randomGenerator );
@@ -747,17 +954,16 @@ void Battle::Arena::CatapultAction()
 
         using TargetUnderlyingType = std::underlying_type_t<decltype( target )>;
 
-        cmd << static_cast<TargetUnderlyingType>( target ) << damage << ( hit ? 1 : 0 );
+        shotActions.emplace_back( Command::CATAPULT, static_cast<TargetUnderlyingType>( target ), damage, ( hit ? 1 : 0 ) );
 
         if ( hit ) {
             stateOfCatapultTargets[target] -= damage;
         }
     }
 
-    // Preserve the order of shots - command arguments will be extracted in reverse order
-    std::reverse( cmd.begin(), cmd.end() );
-
-    ApplyAction( cmd );
+    for ( Command & cmd : shotActions ) {
+        ApplyAction( cmd );
+    }
 }
 
 Battle::Indexes Battle::Arena::GetPath( const Unit & unit, const Position & position )
@@ -25,7 +25,6 @@
 
 #include <array>
 #include <cstdint>
-#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -70,7 +69,7 @@ namespace Battle
         EarthquakeSpell
     };
 
-    class Actions : public std::list<Command>
+    class Actions : public std::vector<Command>
     {};
 
     class TroopsUidGenerator
@@ -86,6 +85,16 @@ namespace Battle
             return _id++;
         }
 
+        uint32_t getNextUnique() const
+        {
+            return _id;
+        }
+
+        void setNextUnique( const uint32_t id )
+        {
+            _id = id;
+        }
+
     private:
         uint32_t _id{ 1 };
     };
@@ -93,6 +102,40 @@ namespace Battle
     class Arena
     {
     public:
+        // A copy of the part of the battle state that can be changed by battle commands: units, board cells, castle towers,
+        // bridge, graveyard, spell points of commanders and the state of the random number generator. It allows to apply
+        // battle commands (for example, to evaluate their consequences during the AI lookahead search) and then roll the
+        // battle back. A snapshot can only be restored to the arena from which it was taken. Snapshots are immutable, so
+        // their copies share the same data and copying is cheap.
+        //
+        // Please note that the surrender command changes the treasuries of kingdoms, this change is not rolled back.
+        class Snapshot
+        {
+        private:
+            friend class Arena;
+
+            struct Data;
+
+            std::shared_ptr<const Data> _data;
+        };
+
+        // While an instance of this class exists, battle commands are applied to the arena without being displayed in the
+        // battle interface (if any).
+        class InterfaceSuspender
+        {
+        public:
+            explicit InterfaceSuspender( Arena & arena );
+            InterfaceSuspender( const InterfaceSuspender & ) = delete;
+
+            ~InterfaceSuspender();
+
+            InterfaceSuspender & operator=( const InterfaceSuspender & ) = delete;
+
+        private:
+            Arena & _arena;
+            std::unique_ptr<Interface> _interface;
+        };
+
         Arena( Army & attackingArmy, Army & defendingArmy, const int32_t tileIndex, const bool isShowInterface, Rand::PCG32 & randomGenerator );
         Arena( const Arena & ) = delete;
         Arena( Arena && ) = delete;
@@ -203,6 +246,9 @@ namespace Battle
 
         void ApplyAction( Command & );
 
+        Snapshot createSnapshot() const;
+        void restoreSnapshot( const Snapshot & snapshot );
+
         // Returns a list of targets that will be affected by the given spell casted by the given hero and applied
         // to a cell with a given index. This method can be used by external code to evaluate the applicability of
         // a spell, and does not use probabilistic mechanisms to determine units resisting the given spell.
@@ -242,6 +288,7 @@ namespace Battle
 
         int32_t GetFreePositionNearHero( const PlayerColor heroColor ) const;
 
+        // These methods provide access to the parts of the arena of the battle that is currently running on the calling thread
         static Board * GetBoard();
         static Tower * GetTower( const TowerType type );
         static Bridge * GetBridge();
@@ -367,11 +414,15 @@ namespace Battle
 
         TroopsUidGenerator _uidGenerator;
 
+        // Actions of the current unit. This buffer is reused for every unit turn to avoid memory allocations.
+        Actions _actions;
+
         enum
         {
             CHAIN_LIGHTNING_CREATURE_COUNT = 4
         };
     };
 
+    // Returns the arena of the battle that is currently running on the calling thread, or nullptr if there is no such battle
     Arena * GetArena();
 }
@@ -44,6 +44,15 @@ namespace Battle
         void ActionDown();
 
         void SetDestroyed();
+
+        // Restores the state of the bridge. The cells of the board are not updated by this method.
+        void setState( const bool isDestroyed, const bool isDown )
+        {
+            assert( !isDestroyed || isDown );
+
+            _isDestroyed = isDestroyed;
+            _isDown = isDown;
+        }
         void SetPassability( const Unit & unit ) const;
 
         bool AllowUp() const
@@ -23,8 +23,6 @@
 
 #include "battle_command.h"
 
-#include <algorithm>
-
 #include "rand.h"
 
 int Battle::Command::GetNextValue()
@@ -40,14 +38,14 @@ uint64_t Battle::Command::updatePCG32Stream( uint64_t stream ) const
 {
     switch ( _type ) {
     case CommandType::ATTACK:
-        assert( size() == 5 );
+        assert( _paramsCount == 5 );
 
         Rand::combineSeedWithValueHash( stream, _type );
         // Use only cell index to move and attacker & defender UIDs, because cell index to attack and attack direction may differ depending on whether the AI or the human
         // player gives the command
-        Rand::combineSeedWithValueHash( stream, at( 2 ) );
-        Rand::combineSeedWithValueHash( stream, at( 3 ) );
-        Rand::combineSeedWithValueHash( stream, at( 4 ) );
+        Rand::combineSeedWithValueHash( stream, _params[2] );
+        Rand::combineSeedWithValueHash( stream, _params[3] );
+        Rand::combineSeedWithValueHash( stream, _params[4] );
         break;
 
     case CommandType::MOVE:
@@ -59,7 +57,9 @@ uint64_t Battle::Command::updatePCG32Stream( uint64_t stream ) const
     case CommandType::SURRENDER:
     case CommandType::SKIP:
         Rand::combineSeedWithValueHash( stream, _type );
-        std::for_each( begin(), end(), [&stream]( const int param ) { Rand::combineSeedWithValueHash( stream, param ); } );
+        for ( size_t i = 0; i < _paramsCount; ++i ) {
+            Rand::combineSeedWithValueHash( stream, _params[i] );
+        }
         break;
 
     // These commands should never affect the stream
@@ -77,16 +77,17 @@ uint64_t Battle::Command::updatePCG32Stream( uint64_t stream ) const
 
 Battle::Command & Battle::Command::operator<<( const int val )
 {
-    push_back( val );
+    assert( _paramsCount < _params.size() );
+
+    _params[_paramsCount++] = val;
 
     return *this;
 }
 
 Battle::Command & Battle::Command::operator>>( int & val )
 {
-    if ( !empty() ) {
-        val = back();
-        pop_back();
+    if ( _paramsCount > 0 ) {
+        val = _params[--_paramsCount];
     }
 
     return *this;
@@ -23,13 +23,13 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <tuple>
 #include <type_traits>
-#include <vector>
 
 #include "spell.h"
 
@@ -50,7 +50,8 @@ namespace Battle
         QUICK_COMBAT
     };
 
-    class Command final : public std::vector<int>
+    // Command parameters are stored inline, so commands can be created, copied and discarded without any memory allocations
+    class Command final
     {
     public:
         static constexpr std::integral_constant<CommandType, CommandType::MOVE> MOVE{};
@@ -99,6 +100,10 @@ namespace Battle
                 // UID, morale
                 static_assert( sizeof...( params ) == 2 );
             }
+            else if constexpr ( cmd == CommandType::CATAPULT ) {
+                // Target, damage, hit
+                static_assert( sizeof...( params ) == 3 );
+            }
             else if constexpr ( cmd == CommandType::TOWER ) {
                 // Tower type, UID
                 static_assert( sizeof...( params ) == 2 );
@@ -116,7 +121,7 @@ namespace Battle
             }
 
             if constexpr ( sizeof...( params ) > 0 ) {
-                reserve( sizeof...( params ) );
+                static_assert( sizeof...( params ) <= maxParamsCount );
 
                 // Put the elements of the parameter pack in reverse order using the right-to-left sequencing of the assignment operator
                 int dummy = 0;
@@ -135,12 +140,18 @@ namespace Battle
         // this command should not affect the stream).
         uint64_t updatePCG32Stream( uint64_t stream ) const;
 
-        Command & operator<<( const int val );
-
     private:
+        // The maximum number of parameters of a command (the attack command has the largest number of them)
+        static constexpr size_t maxParamsCount{ 5 };
+
+        Command & operator<<( const int val );
         Command & operator>>( int & val );
 
         CommandType _type;
+
+        // Parameters are stored in reverse order, so that they can be extracted from the end
+        std::array<int, maxParamsCount> _params{};
+        size_t _paramsCount{ 0 };
     };
 }
 
@@ -1385,6 +1385,21 @@ Battle::Interface::Interface( Arena & battleArena, const int32_t tileIndex )
         break;
     }
 
+    // Decode the battlefield and the monster images in the background while the rest of the interface is being prepared
+    {
+        std::vector<int> icnIds{ _battleGroundIcn, _borderObjectsIcn };
+
+        for ( const Force * force : { &arena.getAttackingForce(), &arena.getDefendingForce() } ) {
+            for ( const Unit * unit : *force ) {
+                assert( unit != nullptr );
+
+                icnIds.push_back( unit->GetMonsterSprite() );
+            }
+        }
+
+        fheroes2::AGG::prefetchICN( icnIds );
+    }
+
     // hexagon
     _hexagonGrid = DrawHexagon( fheroes2::GetColorId( 0x68, 0x8C, 0x04 ) );
     // Shadow under the cursor: the first parameter is the shadow strength (smaller is stronger), the second is the distance between the hexagonal shadows.
@@ -1439,6 +1454,24 @@ Battle::Interface::Interface( Arena & battleArena, const int32_t tileIndex )
     _battleGround.resize( area.width, battlefieldHeight );
 
     AudioManager::ResetAudio();
+
+    // Decode the sounds of all the monsters participating in the battle in advance, so that the first attack or movement of each of them is not delayed.
+    {
+        std::set<int> m82Sounds;
+
+        for ( const Force * force : { &arena.getAttackingForce(), &arena.getDefendingForce() } ) {
+            for ( const Unit * unit : *force ) {
+                assert( unit != nullptr );
+
+                const fheroes2::MonsterSound & sounds = fheroes2::getMonsterData( unit->GetID() ).sounds;
+
+                m82Sounds.insert( { sounds.meleeAttack, sounds.death, sounds.movement, sounds.wince, sounds.rangeAttack, sounds.takeoff, sounds.landing,
+                                    sounds.explosion } );
+            }
+        }
+
+        AudioManager::preloadSoundsAsync( { m82Sounds.begin(), m82Sounds.end() } );
+    }
 }
 
 Battle::Interface::~Interface()
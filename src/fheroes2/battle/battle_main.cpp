@@ -31,6 +31,7 @@
 #include <utility>
 #include <vector>
 
+#include "agg_image.h"
 #include "ai_planner.h"
 #include "army.h"
 #include "army_troop.h"
@@ -42,6 +43,7 @@
 #include "captain.h"
 #include "dialog.h"
 #include "game.h"
+#include "game_turn_profiler.h"
 #include "heroes.h"
 #include "heroes_base.h"
 #include "kingdom.h"
@@ -290,6 +292,8 @@ namespace
 
 Battle::Result Battle::Loader( Army & attackingArmy, Army & defendingArmy, const int32_t tileIndex )
 {
+    const TurnProfiler::PhaseTimer phaseTimer( TurnProfiler::Phase::BATTLES );
+
     Result result;
 
     // Validate the arguments - check if battle should even load
@@ -381,6 +385,9 @@ Battle::Result Battle::Loader( Army & attackingArmy, Army & defendingArmy, const
     }
 #endif
 
+    // Large images of the battlefield are released once the battle is over
+    const fheroes2::AGG::ScreenImagesScope screenImagesScope;
+
     const uint32_t battleSeed = computeBattleSeed( tileIndex, world.GetMapSeed(), attackingArmy, defendingArmy );
 
     while ( true ) {
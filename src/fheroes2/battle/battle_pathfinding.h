@@ -21,10 +21,9 @@
 #pragma once
 
 #include <array>
-#include <cstddef>
 #include <cstdint>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "battle_board.h"
 #include "color.h"
@@ -36,19 +35,6 @@ namespace Battle
 
     using BattleNodeIndex = std::pair<int32_t, int32_t>;
 
-    struct BattleNodeIndexHash final
-    {
-        std::size_t operator()( const BattleNodeIndex & index ) const noexcept
-        {
-            const uint64_t f = index.first;
-            const uint64_t s = index.second;
-
-            std::hash<uint64_t> hasher;
-
-            return hasher( ( f << 32 ) + s );
-        }
-    };
-
     struct BattleNode final
     {
         BattleNodeIndex _from{ -1, -1 };
@@ -109,7 +95,23 @@ namespace Battle
         // Rebuilds the graph of available positions for the given unit if necessary (if it is not already cached)
         void reEvaluateIfNeeded( const Unit & unit );
 
-        std::unordered_map<BattleNodeIndex, BattleNode, BattleNodeIndexHash> _cache;
+        // Returns the node corresponding to the given index. Every board cell has two nodes: the first one is used
+        // by narrow units and by wide units whose tail is located to the left of the head, the second one is used
+        // by wide units whose tail is located to the right of the head.
+        BattleNode & getNode( const BattleNodeIndex & nodeIdx );
+        const BattleNode & getNode( const BattleNodeIndex & nodeIdx ) const;
+
+        // Checks whether the node with the given index was reached when building the current cache
+        bool isNodeReached( const BattleNodeIndex & nodeIdx ) const
+        {
+            return nodeIdx == _pathStart || getNode( nodeIdx )._from != BattleNodeIndex{ -1, -1 };
+        }
+
+        std::array<BattleNode, Board::sizeInCells * 2> _cache;
+
+        // Queue of nodes to explore when building the cache. It is kept between the cache rebuilds to avoid
+        // unnecessary memory allocations.
+        std::vector<BattleNodeIndex> _nodesToExplore;
 
         // Parameters of the unit for which the current cache is created
         BattleNodeIndex _pathStart{ -1, -1 };
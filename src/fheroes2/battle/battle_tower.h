@@ -58,6 +58,12 @@ namespace Battle
 
         void SetDestroyed();
 
+        // Restores the validity of the tower. The cells of the board are not updated by this method.
+        void setValid( const bool isValid )
+        {
+            _isValid = isValid;
+        }
+
         // Returns a text description of the parameters of the towers of a given castle. Can be
         // called both during combat and outside of it. In the former case, the current state of
         // the towers destroyed during the siege will be reflected.
@@ -1708,6 +1708,44 @@ void Battle::Unit::removeAffection( const uint32_t mode )
     _affected.RemoveMode( mode );
 }
 
+Battle::Unit::State Battle::Unit::getState() const
+{
+    State state;
+
+    state.affected = _affected;
+    state.position = _position;
+    state.mirrorUnit = _mirrorUnit;
+    state.count = GetCount();
+    state.modes = modes;
+    state.hitPoints = _hitPoints;
+    state.maxCount = _maxCount;
+    state.deadCount = _deadCount;
+    state.shotsLeft = _shotsLeft;
+    state.disruptingRaysNum = _disruptingRaysNum;
+    state.customAlphaMask = _customAlphaMask;
+    state.isReflected = _isReflected;
+    state.blindRetaliation = _blindRetaliation;
+
+    return state;
+}
+
+void Battle::Unit::setState( const State & state )
+{
+    _affected = state.affected;
+    _position = state.position;
+    _mirrorUnit = state.mirrorUnit;
+    SetCount( state.count );
+    modes = state.modes;
+    _hitPoints = state.hitPoints;
+    _maxCount = state.maxCount;
+    _deadCount = state.deadCount;
+    _shotsLeft = state.shotsLeft;
+    _disruptingRaysNum = state.disruptingRaysNum;
+    _customAlphaMask = state.customAlphaMask;
+    _isReflected = state.isReflected;
+    _blindRetaliation = state.blindRetaliation;
+}
+
 void Battle::Unit::_replaceAffection( const uint32_t modeToReplace, const uint32_t replacementMode, const uint32_t duration )
 {
     removeAffection( modeToReplace );
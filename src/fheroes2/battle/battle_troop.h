@@ -337,6 +337,28 @@ namespace Battle
         // Removes temporary affection(s) (usually spell effect(s)). Multiple affections can be removed using a single call.
         void removeAffection( const uint32_t mode );
 
+        // The part of the state of a unit that can be changed by battle commands
+        struct State
+        {
+            ModesAffected affected;
+            Position position;
+            Unit * mirrorUnit{ nullptr };
+            uint32_t count{ 0 };
+            uint32_t modes{ 0 };
+            uint32_t hitPoints{ 0 };
+            uint32_t maxCount{ 0 };
+            uint32_t deadCount{ 0 };
+            uint32_t shotsLeft{ 0 };
+            uint32_t disruptingRaysNum{ 0 };
+            uint8_t customAlphaMask{ 255 };
+            bool isReflected{ false };
+            bool blindRetaliation{ false };
+        };
+
+        State getState() const;
+        // Restores the state of this unit. The cells of the board (if any) are not updated by this method.
+        void setState( const State & state );
+
         // TODO: find a better way to expose it without a million getters/setters
         AnimationState animation;
 
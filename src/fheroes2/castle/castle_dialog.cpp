@@ -52,10 +52,12 @@
 #include "kingdom.h"
 #include "localevent.h"
 #include "m82.h"
+#include "maps_fileinfo.h"
 #include "math_base.h"
 #include "monster.h"
 #include "mus.h"
 #include "screen.h"
+#include "settings.h"
 #include "statusbar.h"
 #include "tools.h"
 #include "translations.h"
@@ -222,6 +224,19 @@ Castle::CastleDialogReturnValue Castle::OpenDialog( const bool openConstructionW
     // or from the Game Area that will set the appropriate cursor after this dialog is closed.
     Cursor::Get().SetThemes( Cursor::POINTER );
 
+    // Decode the images of the castle buildings in the background while the dialog is being prepared
+    {
+        std::vector<int> icnIds;
+
+        for ( const BuildingType building : fheroes2::getBuildingDrawingPriorities( _race, Settings::Get().getCurrentMapInfo().version ) ) {
+            if ( isBuild( building ) ) {
+                icnIds.push_back( GetICNBuilding( building, _race ) );
+            }
+        }
+
+        fheroes2::AGG::prefetchICN( icnIds );
+    }
+
     fheroes2::Display & display = fheroes2::Display::instance();
 
     fheroes2::Rect dialogRoi;
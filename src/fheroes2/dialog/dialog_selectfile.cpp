@@ -27,7 +27,6 @@
 #include <ctime>
 #include <iomanip>
 #include <iterator>
-#include <list>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -37,7 +36,6 @@
 #include "agg_image.h"
 #include "cursor.h"
 #include "dialog.h" // IWYU pragma: associated
-#include "dir.h"
 #include "game_hotkeys.h"
 #include "game_io.h"
 #include "icn.h"
@@ -228,19 +226,7 @@ namespace
 
     MapsFileInfoList getSortedMapsFileInfoList()
     {
-        ListFiles files;
-        files.ReadDir( Game::GetSaveDir(), Game::GetSaveFileExtension() );
-
-        MapsFileInfoList mapInfos;
-        mapInfos.reserve( files.size() );
-
-        for ( std::string & saveFile : files ) {
-            Maps::FileInfo mapInfo;
-
-            if ( Game::LoadSAV2FileInfo( std::move( saveFile ), mapInfo ) ) {
-                mapInfos.emplace_back( std::move( mapInfo ) );
-            }
-        }
+        MapsFileInfoList mapInfos = Game::getSaveFileInfos();
 
         sortMapInfos( mapInfos );
 
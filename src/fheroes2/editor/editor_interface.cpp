@@ -2441,8 +2441,11 @@ namespace Interface
 
                 action.commit();
 
-                // TODO: so far this is the only way to update objects for rendering.
-                return Maps::readMapInEditor( _mapFormat );
+                // The object is now placed above all other objects on its tiles. Only these tiles need to be read again to render it.
+                std::set<int32_t> tileIndices;
+                Maps::addObjectsTileIndices( _mapFormat, tileIndex, _mapFormat.tiles[tileIndex], tileIndices );
+
+                return Maps::readMapTilesInEditor( _mapFormat, std::move( tileIndices ) ) || Maps::readMapInEditor( _mapFormat );
             }
         }
 
@@ -22,6 +22,12 @@
 
 #include <cassert>
 #include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "map_format_helper.h"
 #include "map_format_info.h"
@@ -29,21 +35,206 @@
 
 namespace
 {
-    // This class holds 2 copies of MapFormat objects:
-    // - one copy before the action
-    // - one copy after the action
-    // Ideally, we need to store only difference between before and after an action
-    // but for simplification purposes we chose this way.
-    // TODO: optimize this class (if possible) to store less data.
+    // The map information which is not related to tiles and objects on them.
+    struct MapInfo
+    {
+        explicit MapInfo( const Maps::Map_Format::MapFormat & map )
+            : base( map )
+            , additionalInfo( map.additionalInfo )
+            , dailyEvents( map.dailyEvents )
+            , rumors( map.rumors )
+        {
+            // Do nothing.
+        }
+
+        static bool isSame( const Maps::Map_Format::MapFormat & map, const Maps::Map_Format::MapFormat & anotherMap )
+        {
+            return static_cast<const Maps::Map_Format::BaseMapFormat &>( map ) == anotherMap && map.additionalInfo == anotherMap.additionalInfo
+                   && map.dailyEvents == anotherMap.dailyEvents && map.rumors == anotherMap.rumors;
+        }
+
+        void apply( Maps::Map_Format::MapFormat & map ) const
+        {
+            static_cast<Maps::Map_Format::BaseMapFormat &>( map ) = base;
+            map.additionalInfo = additionalInfo;
+            map.dailyEvents = dailyEvents;
+            map.rumors = rumors;
+        }
+
+        Maps::Map_Format::BaseMapFormat base;
+        std::vector<uint32_t> additionalInfo;
+        std::vector<Maps::Map_Format::DailyEvent> dailyEvents;
+        std::vector<std::string> rumors;
+    };
+
+    struct TileChange
+    {
+        int32_t tileIndex{ -1 };
+
+        Maps::Map_Format::TileInfo before;
+        Maps::Map_Format::TileInfo after;
+    };
+
+    // An empty value means that there is no metadata for the object.
+    template <typename T>
+    struct MetadataChange
+    {
+        uint32_t uid{ 0 };
+
+        std::optional<T> before;
+        std::optional<T> after;
+    };
+
+    template <typename T>
+    void findMetadataChanges( const std::map<uint32_t, T> & before, const std::map<uint32_t, T> & after, std::vector<MetadataChange<T>> & changes )
+    {
+        auto beforeIter = before.begin();
+        auto afterIter = after.begin();
+
+        while ( beforeIter != before.end() || afterIter != after.end() ) {
+            if ( afterIter == after.end() || ( beforeIter != before.end() && beforeIter->first < afterIter->first ) ) {
+                // The metadata has been removed.
+                changes.push_back( { beforeIter->first, beforeIter->second, std::nullopt } );
+                ++beforeIter;
+            }
+            else if ( beforeIter == before.end() || afterIter->first < beforeIter->first ) {
+                // The metadata has been added.
+                changes.push_back( { afterIter->first, std::nullopt, afterIter->second } );
+                ++afterIter;
+            }
+            else {
+                if ( beforeIter->second != afterIter->second ) {
+                    changes.push_back( { beforeIter->first, beforeIter->second, afterIter->second } );
+                }
+
+                ++beforeIter;
+                ++afterIter;
+            }
+        }
+    }
+
+    template <typename T>
+    void applyMetadataChanges( std::map<uint32_t, T> & metadata, const std::vector<MetadataChange<T>> & changes, const bool isRedo )
+    {
+        for ( const MetadataChange<T> & change : changes ) {
+            const std::optional<T> & value = isRedo ? change.after : change.before;
+            if ( value ) {
+                metadata[change.uid] = *value;
+            }
+            else {
+                metadata.erase( change.uid );
+            }
+        }
+    }
+
+    // The difference between two states of the map. Only changed tiles, metadata and map information are stored.
+    class MapChanges
+    {
+    public:
+        MapChanges( const Maps::Map_Format::MapFormat & before, const Maps::Map_Format::MapFormat & after )
+        {
+            assert( before.tiles.size() == after.tiles.size() );
+
+            for ( size_t i = 0; i < after.tiles.size(); ++i ) {
+                if ( before.tiles[i] != after.tiles[i] ) {
+                    _tiles.push_back( { static_cast<int32_t>( i ), before.tiles[i], after.tiles[i] } );
+                }
+            }
+
+            if ( !MapInfo::isSame( before, after ) ) {
+                _infoBefore.emplace( before );
+                _infoAfter.emplace( after );
+            }
+
+            findMetadataChanges( before.castleMetadata, after.castleMetadata, _castleMetadata );
+            findMetadataChanges( before.heroMetadata, after.heroMetadata, _heroMetadata );
+            findMetadataChanges( before.sphinxMetadata, after.sphinxMetadata, _sphinxMetadata );
+            findMetadataChanges( before.signMetadata, after.signMetadata, _signMetadata );
+            findMetadataChanges( before.adventureMapEventMetadata, after.adventureMapEventMetadata, _adventureMapEventMetadata );
+            findMetadataChanges( before.selectionObjectMetadata, after.selectionObjectMetadata, _selectionObjectMetadata );
+            findMetadataChanges( before.capturableObjectsMetadata, after.capturableObjectsMetadata, _capturableObjectsMetadata );
+            findMetadataChanges( before.monsterMetadata, after.monsterMetadata, _monsterMetadata );
+            findMetadataChanges( before.artifactMetadata, after.artifactMetadata, _artifactMetadata );
+            findMetadataChanges( before.resourceMetadata, after.resourceMetadata, _resourceMetadata );
+        }
+
+        // Applies the changes to the map which must be in the state before (for redo) or after (for undo) the changes.
+        void apply( Maps::Map_Format::MapFormat & map, const bool isRedo ) const
+        {
+            for ( const TileChange & change : _tiles ) {
+                assert( change.tileIndex >= 0 && static_cast<size_t>( change.tileIndex ) < map.tiles.size() );
+
+                map.tiles[change.tileIndex] = isRedo ? change.after : change.before;
+            }
+
+            if ( _infoBefore ) {
+                assert( _infoAfter );
+
+                ( isRedo ? *_infoAfter : *_infoBefore ).apply( map );
+            }
+
+            applyMetadataChanges( map.castleMetadata, _castleMetadata, isRedo );
+            applyMetadataChanges( map.heroMetadata, _heroMetadata, isRedo );
+            applyMetadataChanges( map.sphinxMetadata, _sphinxMetadata, isRedo );
+            applyMetadataChanges( map.signMetadata, _signMetadata, isRedo );
+            applyMetadataChanges( map.adventureMapEventMetadata, _adventureMapEventMetadata, isRedo );
+            applyMetadataChanges( map.selectionObjectMetadata, _selectionObjectMetadata, isRedo );
+            applyMetadataChanges( map.capturableObjectsMetadata, _capturableObjectsMetadata, isRedo );
+            applyMetadataChanges( map.monsterMetadata, _monsterMetadata, isRedo );
+            applyMetadataChanges( map.artifactMetadata, _artifactMetadata, isRedo );
+            applyMetadataChanges( map.resourceMetadata, _resourceMetadata, isRedo );
+        }
+
+        // Updates the world after the changes have been applied to the map. Only the changed tiles are read when it is possible.
+        bool updateWorld( const Maps::Map_Format::MapFormat & map ) const
+        {
+            if ( _infoBefore || !_castleMetadata.empty() || !_heroMetadata.empty() || !_capturableObjectsMetadata.empty() ) {
+                // Towns, heroes and object owners are updated only while reading the whole map.
+                return Maps::readMapInEditor( map );
+            }
+
+            // The tiles of added and removed objects must be read as well.
+            std::set<int32_t> tileIndices;
+
+            for ( const TileChange & change : _tiles ) {
+                tileIndices.emplace( change.tileIndex );
+
+                Maps::addObjectsTileIndices( map, change.tileIndex, change.before, tileIndices );
+                Maps::addObjectsTileIndices( map, change.tileIndex, change.after, tileIndices );
+            }
+
+            return Maps::readMapTilesInEditor( map, std::move( tileIndices ) ) || Maps::readMapInEditor( map );
+        }
+
+    private:
+        std::vector<TileChange> _tiles;
+
+        std::optional<MapInfo> _infoBefore;
+        std::optional<MapInfo> _infoAfter;
+
+        std::vector<MetadataChange<Maps::Map_Format::CastleMetadata>> _castleMetadata;
+        std::vector<MetadataChange<Maps::Map_Format::HeroMetadata>> _heroMetadata;
+        std::vector<MetadataChange<Maps::Map_Format::SphinxMetadata>> _sphinxMetadata;
+        std::vector<MetadataChange<Maps::Map_Format::SignMetadata>> _signMetadata;
+        std::vector<MetadataChange<Maps::Map_Format::AdventureMapEventMetadata>> _adventureMapEventMetadata;
+        std::vector<MetadataChange<Maps::Map_Format::SelectionObjectMetadata>> _selectionObjectMetadata;
+        std::vector<MetadataChange<Maps::Map_Format::CapturableObjectMetadata>> _capturableObjectsMetadata;
+        std::vector<MetadataChange<Maps::Map_Format::MonsterMetadata>> _monsterMetadata;
+        std::vector<MetadataChange<Maps::Map_Format::ArtifactMetadata>> _artifactMetadata;
+        std::vector<MetadataChange<Maps::Map_Format::ResourceMetadata>> _resourceMetadata;
+    };
+
+    // This class holds only the changes made by an action. The map state before the action is kept by History Manager
+    // and it is shared between all actions. It is always equal to the map after the last applied (done, undone or redone) action.
     class MapAction final : public fheroes2::Action
     {
     public:
-        explicit MapAction( Maps::Map_Format::MapFormat & mapFormat )
+        MapAction( Maps::Map_Format::MapFormat & mapFormat, std::shared_ptr<Maps::Map_Format::MapFormat> mapState )
             : _mapFormat( mapFormat )
-            , _beforeMapFormat( mapFormat )
+            , _mapState( std::move( mapState ) )
             , _latestObjectUIDBefore( Maps::getLastObjectUID() )
         {
-            // Do nothing.
+            assert( _mapState );
         }
 
         // Disable the copy and move (implicitly) constructors and assignment operators.
@@ -53,7 +244,10 @@ namespace
 
         bool prepare()
         {
-            _afterMapFormat = _mapFormat;
+            assert( !_changes );
+
+            _changes.emplace( *_mapState, _mapFormat );
+            _changes->apply( *_mapState, true );
 
             _latestObjectUIDAfter = Maps::getLastObjectUID();
 
@@ -62,8 +256,16 @@ namespace
 
         bool redo() override
         {
-            _mapFormat = _afterMapFormat;
-            if ( !Maps::readMapInEditor( _mapFormat ) ) {
+            if ( !_changes ) {
+                // This action was never prepared.
+                assert( 0 );
+                return false;
+            }
+
+            _changes->apply( _mapFormat, true );
+            _changes->apply( *_mapState, true );
+
+            if ( !_changes->updateWorld( _mapFormat ) ) {
                 // If this assertion blows up then something is really wrong with the Editor.
                 assert( 0 );
                 return false;
@@ -76,8 +278,15 @@ namespace
 
         bool undo() override
         {
-            _mapFormat = _beforeMapFormat;
-            if ( !Maps::readMapInEditor( _mapFormat ) ) {
+            if ( !_changes ) {
+                // The action is being reverted before it has been committed. Find all changes to revert them.
+                prepare();
+            }
+
+            _changes->apply( _mapFormat, false );
+            _changes->apply( *_mapState, false );
+
+            if ( !_changes->updateWorld( _mapFormat ) ) {
                 // If this assertion blows up then something is really wrong with the Editor.
                 assert( 0 );
                 return false;
@@ -91,8 +300,9 @@ namespace
     private:
         Maps::Map_Format::MapFormat & _mapFormat;
 
-        const Maps::Map_Format::MapFormat _beforeMapFormat;
-        Maps::Map_Format::MapFormat _afterMapFormat;
+        const std::shared_ptr<Maps::Map_Format::MapFormat> _mapState;
+
+        std::optional<MapChanges> _changes;
 
         const uint32_t _latestObjectUIDBefore{ 0 };
         uint32_t _latestObjectUIDAfter{ 0 };
@@ -104,7 +314,7 @@ namespace fheroes2
     ActionCreator::ActionCreator( HistoryManager & manager, Maps::Map_Format::MapFormat & mapFormat )
         : _manager( manager )
     {
-        _action = std::make_unique<MapAction>( mapFormat );
+        _action = std::make_unique<MapAction>( mapFormat, manager.getMapState( mapFormat ) );
     }
 
     void ActionCreator::commit()
@@ -120,4 +330,26 @@ namespace fheroes2
             _manager.add( std::move( _action ) );
         }
     }
+
+    std::shared_ptr<Maps::Map_Format::MapFormat> HistoryManager::getMapState( const Maps::Map_Format::MapFormat & mapFormat )
+    {
+        // The map state is copied only once after the reset of the history. A map of another size means that a new map was loaded without the reset.
+        if ( !_mapState || _mapState->tiles.size() != mapFormat.tiles.size() ) {
+            _actions.clear();
+            _lastActionId = 0;
+
+            _mapState = std::make_shared<Maps::Map_Format::MapFormat>( mapFormat );
+
+            if ( _stateCallback ) {
+                _stateCallback( false, false );
+            }
+        }
+        else {
+            // The map could be modified outside of actions, for example, the map name is set while saving the map.
+            // Such changes must not become a part of the next action.
+            MapChanges( *_mapState, mapFormat ).apply( *_mapState, true );
+        }
+
+        return _mapState;
+    }
 }
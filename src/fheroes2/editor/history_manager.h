@@ -85,6 +85,7 @@ namespace fheroes2
         {
             _actions.clear();
             _lastActionId = 0;
+            _mapState.reset();
 
             if ( _stateCallback ) {
                 _stateCallback( false, false );
@@ -155,6 +156,9 @@ namespace fheroes2
             return result;
         }
 
+        // Returns the map state after the last applied action. Actions use it to find and apply the changes of the map.
+        std::shared_ptr<Maps::Map_Format::MapFormat> getMapState( const Maps::Map_Format::MapFormat & mapFormat );
+
     private:
         // We shouldn't store too many actions. It is extremely rare when there is a need to revert so many changes.
         static const size_t maxActions{ 500 };
@@ -163,6 +167,8 @@ namespace fheroes2
 
         size_t _lastActionId{ 0 };
 
+        std::shared_ptr<Maps::Map_Format::MapFormat> _mapState;
+
         std::function<void( const bool, const bool )> _stateCallback;
     };
 }
@@ -21,12 +21,15 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
  ***************************************************************************/
 
+#include <cctype>
+#include <cerrno>
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <memory>
 #include <set>
@@ -45,6 +48,7 @@
 #include <SDL_events.h>
 #include <SDL_main.h> // IWYU pragma: keep
 #include <SDL_mouse.h>
+#include <SDL_stdinc.h>
 
 // Managing compiler warnings for SDL headers
 #if defined( __GNUC__ )
@@ -64,6 +68,8 @@
 #include "embedded_image.h"
 #include "exception.h"
 #include "game.h"
+#include "game_benchmark.h"
+#include "game_io.h"
 #include "game_logo.h"
 #include "game_video.h"
 #include "game_video_type.h"
@@ -276,6 +282,65 @@ namespace
         const ListFiles maps = Settings::FindFiles( "maps", ".mp2", false );
         return maps.size() == 1;
     }
+
+    // Parses a non-negative decimal number which fits into 32 bits. Returns false if the whole value is not such a number.
+    bool parseUnsignedNumber( const char * value, uint32_t & number )
+    {
+        if ( !std::isdigit( static_cast<unsigned char>( value[0] ) ) ) {
+            return false;
+        }
+
+        errno = 0;
+
+        char * end = nullptr;
+        const unsigned long long result = std::strtoull( value, &end, 10 );
+        if ( *end != '\0' || errno == ERANGE || result > std::numeric_limits<uint32_t>::max() ) {
+            return false;
+        }
+
+        number = static_cast<uint32_t>( result );
+        return true;
+    }
+
+    // Parses the "--benchmark <file> [--days <number>] [--seed <number>]" command line options. The benchmark mode is requested
+    // if the file path is set. Returns false and reports an error if any of these options is invalid.
+    bool parseBenchmarkParameters( const int argc, char ** argv, Benchmark::Parameters & parameters )
+    {
+        for ( int i = 1; i < argc; ++i ) {
+            const std::string option = argv[i];
+            if ( option != "--benchmark" && option != "--days" && option != "--seed" ) {
+                continue;
+            }
+
+            if ( i + 1 >= argc ) {
+                ERROR_LOG( "The " << option << " command line option requires a value." )
+                return false;
+            }
+
+            const char * value = argv[++i];
+
+            if ( option == "--benchmark" ) {
+                if ( *value == '\0' ) {
+                    ERROR_LOG( "The file for the benchmark is not specified." )
+                    return false;
+                }
+
+                parameters.filePath = value;
+            }
+            else if ( option == "--days" ) {
+                if ( !parseUnsignedNumber( value, parameters.days ) || parameters.days == 0 ) {
+                    ERROR_LOG( "Invalid number of days for the benchmark: " << value )
+                    return false;
+                }
+            }
+            else if ( !parseUnsignedNumber( value, parameters.seed ) ) {
+                ERROR_LOG( "Invalid seed for the benchmark: " << value )
+                return false;
+            }
+        }
+
+        return true;
+    }
 }
 
 int main( int argc, char ** argv )
@@ -285,8 +350,6 @@ int main( int argc, char ** argv )
     assert( argc == __argc );
 
     argv = __argv;
-#else
-    (void)argc;
 #endif
 
     try {
@@ -302,8 +365,22 @@ int main( int argc, char ** argv )
         InitDataDir();
         ReadConfigs();
 
-        std::set<fheroes2::SystemInitializationComponent> coreComponents{ fheroes2::SystemInitializationComponent::Audio,
-                                                                          fheroes2::SystemInitializationComponent::Video };
+        Benchmark::Parameters benchmarkParameters;
+        if ( !parseBenchmarkParameters( argc, argv, benchmarkParameters ) ) {
+            return EXIT_FAILURE;
+        }
+
+        const bool isBenchmark = !benchmarkParameters.filePath.empty();
+
+        std::set<fheroes2::SystemInitializationComponent> coreComponents{ fheroes2::SystemInitializationComponent::Video };
+
+        if ( isBenchmark ) {
+            // Nothing is shown during the benchmark so there is no need for a window.
+            SDL_setenv( "SDL_VIDEODRIVER", "dummy", 1 );
+        }
+        else {
+            coreComponents.emplace( fheroes2::SystemInitializationComponent::Audio );
+        }
 
 #if defined( TARGET_PS_VITA ) || defined( TARGET_NINTENDO_SWITCH )
         coreComponents.emplace( fheroes2::SystemInitializationComponent::GameController );
@@ -358,13 +435,19 @@ int main( int argc, char ** argv )
         // Initialize game data.
         Game::Init();
 
-        if ( conf.isShowIntro() ) {
+        if ( conf.isShowIntro() && !isBenchmark ) {
             fheroes2::showTeamInfo();
             for ( const auto & logo : { "NWCLOGO.SMK", "CYLOGO.SMK", "H2XINTRO.SMK" } ) {
                 Video::ShowVideo( { { logo, Video::VideoControl::PLAY_CUTSCENE } } );
             }
         }
 
+        const Game::IOInitializer gameIOInitializer;
+
+        if ( isBenchmark ) {
+            return Benchmark::run( benchmarkParameters ) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+
         try {
             const CursorRestorer cursorRestorer( true, Cursor::POINTER );
             const fheroes2::Point pos = conf.getSavedWindowPos();
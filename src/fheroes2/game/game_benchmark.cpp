@@ -0,0 +1,234 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2025                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "game_benchmark.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include "ai_planner.h"
+#include "color.h"
+#include "game.h"
+#include "game_mode.h"
+#include "game_over.h"
+#include "game_turn_profiler.h"
+#include "kingdom.h"
+#include "logging.h"
+#include "maps_fileinfo.h"
+#include "players.h"
+#include "rand.h"
+#include "settings.h"
+#include "timing.h"
+#include "tools.h"
+#include "world.h"
+
+namespace
+{
+    bool isHeadless{ false };
+
+    // Same order of turns as in Interface::AdventureMap::StartGame(): human players go first
+    bool SortPlayers( const Player * player1, const Player * player2 )
+    {
+        return ( player1->isControlHuman() && !player2->isControlHuman() )
+               || ( ( player1->isControlHuman() == player2->isControlHuman() ) && ( player1->GetColor() < player2->GetColor() ) );
+    }
+
+    bool loadMap( const std::string & filePath, const std::string & fileExtension )
+    {
+        Maps::FileInfo mapInfo;
+
+        if ( fileExtension == ".fh2m" ) {
+            if ( !mapInfo.readResurrectionMap( filePath, false ) ) {
+                return false;
+            }
+        }
+        else if ( !mapInfo.readMP2Map( filePath, false ) ) {
+            return false;
+        }
+
+        Settings & conf = Settings::Get();
+
+        conf.SetGameType( Game::TYPE_STANDARD );
+        conf.setCurrentMapInfo( std::move( mapInfo ) );
+        conf.GetPlayers().SetStartGame();
+
+        const Maps::FileInfo & currentMapInfo = conf.getCurrentMapInfo();
+
+        if ( currentMapInfo.version == GameVersion::RESURRECTION ) {
+            return world.loadResurrectionMap( currentMapInfo.filename );
+        }
+
+        return world.LoadMapMP2( currentMapInfo.filename, ( currentMapInfo.version == GameVersion::SUCCESSION_WARS ) );
+    }
+
+    bool loadGame( const std::string & filePath )
+    {
+        const size_t extensionPos = filePath.rfind( '.' );
+        const std::string fileExtension = ( extensionPos == std::string::npos ) ? std::string{} : StringLower( filePath.substr( extensionPos ) );
+
+        if ( fileExtension == ".fh2m" || fileExtension == ".mp2" || fileExtension == ".mx2" ) {
+            if ( !loadMap( filePath, fileExtension ) ) {
+                return false;
+            }
+
+            GameOver::Result::Get().Reset();
+
+            return true;
+        }
+
+        // Saves of all game types are accepted
+        Settings::Get().SetGameType( Game::TYPE_STANDARD | Game::TYPE_CAMPAIGN | Game::TYPE_HOTSEAT );
+
+        return Game::Load( filePath ) == fheroes2::GameMode::START_GAME;
+    }
+}
+
+namespace Benchmark
+{
+    bool isHeadlessMode()
+    {
+        return isHeadless;
+    }
+
+    bool run( const Parameters & parameters )
+    {
+        isHeadless = true;
+
+        Rand::CurrentThreadRandomDevice() = Rand::PCG32( parameters.seed );
+
+        if ( !loadGame( parameters.filePath ) ) {
+            ERROR_LOG( "Failed to load the file " << parameters.filePath )
+            return false;
+        }
+
+        Settings & conf = Settings::Get();
+
+        // AI heroes are moved without any animation
+        conf.SetAIMoveSpeed( 0 );
+
+        const bool isLoadedFromSave = conf.LoadedGameVersion();
+
+        // The order of turns must be determined before human players are put under AI control
+        std::vector<Player *> sortedPlayers = conf.GetPlayers().getVector();
+        std::sort( sortedPlayers.begin(), sortedPlayers.end(), SortPlayers );
+
+        for ( const Player * player : sortedPlayers ) {
+            Players::SetPlayerControl( player->GetColor(), CONTROL_AI );
+        }
+
+        if ( !isLoadedFromSave || world.CountDay() == 1 ) {
+            for ( const Player * player : sortedPlayers ) {
+                world.ClearFog( player->GetColor() );
+            }
+        }
+
+        // The game saved during a turn is resumed from the player whose turn it was
+        const PlayerColor savedCurrentColor = conf.CurrentColor();
+        bool skipTurns = isLoadedFromSave;
+        bool isFirstTurnAfterLoading = isLoadedFromSave;
+
+        GameOver::Result & gameResult = GameOver::Result::Get();
+        fheroes2::GameMode res = fheroes2::GameMode::END_TURN;
+
+        const fheroes2::Time benchmarkTimer;
+        uint32_t daysPlayed = 0;
+
+        while ( res == fheroes2::GameMode::END_TURN && daysPlayed < parameters.days ) {
+            const fheroes2::Time dayTimer;
+            double newDayTime = 0;
+
+            if ( !isFirstTurnAfterLoading ) {
+                world.NewDay();
+
+                newDayTime = dayTimer.getS();
+            }
+
+            res = gameResult.checkGameOver();
+            if ( res != fheroes2::GameMode::CANCEL ) {
+                break;
+            }
+
+            res = fheroes2::GameMode::END_TURN;
+
+            for ( const Player * player : sortedPlayers ) {
+                assert( player != nullptr );
+
+                if ( skipTurns ) {
+                    if ( !player->isColor( savedCurrentColor ) ) {
+                        continue;
+                    }
+
+                    skipTurns = false;
+                }
+
+                const PlayerColor playerColor = player->GetColor();
+                Kingdom & kingdom = world.GetKingdom( playerColor );
+
+                if ( kingdom.isPlay() ) {
+                    conf.SetCurrentColor( playerColor );
+
+                    if ( !isFirstTurnAfterLoading ) {
+                        kingdom.ActionNewDayResourceUpdate( nullptr );
+                    }
+
+                    kingdom.ActionBeforeTurn();
+
+                    const fheroes2::Time turnTimer;
+
+                    TurnProfiler::reset();
+
+                    res = AI::Planner::Get().KingdomTurn( kingdom );
+
+                    TurnProfiler::logKingdomTurn( playerColor, turnTimer.getS() );
+
+                    if ( res != fheroes2::GameMode::END_TURN ) {
+                        break;
+                    }
+
+                    res = gameResult.checkGameOver();
+                    if ( res != fheroes2::GameMode::CANCEL ) {
+                        break;
+                    }
+
+                    res = fheroes2::GameMode::END_TURN;
+                }
+
+                isFirstTurnAfterLoading = false;
+            }
+
+            if ( skipTurns ) {
+                ERROR_LOG( "The current player from the save file was not found, player color: " << Color::String( savedCurrentColor ) )
+                return false;
+            }
+
+            TurnProfiler::logDay( world.CountDay(), dayTimer.getS(), newDayTime );
+
+            conf.SetCurrentColor( PlayerColor::NONE );
+
+            ++daysPlayed;
+        }
+
+        COUT( "Benchmark: " << daysPlayed << " days played in " << benchmarkTimer.getS() << " s" )
+
+        return true;
+    }
+}
@@ -0,0 +1,48 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2025                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Headless benchmark of AI turns. The game is loaded from a save or map file, every player is put under AI control, and the given
+// number of days is played without rendering anything. The time of each day, each kingdom turn and its phases is written to the log
+// (see TurnProfiler).
+namespace Benchmark
+{
+    struct Parameters
+    {
+        // Path to a save file or to a map file
+        std::string filePath;
+
+        uint32_t days{ 28 };
+
+        // Seed of the random number generator of the main thread
+        uint32_t seed{ 0 };
+    };
+
+    // Returns true if the game is running in the headless benchmark mode. In this mode nothing is rendered on the adventure map and
+    // dialogs are closed without waiting for the user input.
+    bool isHeadlessMode();
+
+    // Runs the benchmark with the given parameters. Returns false if the file cannot be loaded.
+    bool run( const Parameters & parameters );
+}
@@ -24,6 +24,7 @@
 #include "game_interface.h"
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "agg_image.h"
@@ -131,13 +132,36 @@ void Interface::AdventureMap::redraw( const uint32_t force )
     const uint32_t combinedRedraw = _redraw | force;
     const bool hideInterface = conf.isHideInterfaceEnabled();
 
-    if ( combinedRedraw & REDRAW_GAMEAREA ) {
+    // Only the updated part of the display needs to be rendered if nothing but animated objects of the game area are redrawn.
+    // In the "no interface" mode interface elements are rendered over the game area so everything must be redrawn.
+    const bool isPartialRender = ( combinedRedraw == REDRAW_GAMEAREA_ANIMATION ) && !hideInterface;
+    if ( !isPartialRender ) {
+        _isPartialRenderPlanned = false;
+        _partialRenderAreas.clear();
+    }
+
+    if ( ( combinedRedraw & REDRAW_GAMEAREA ) || ( hideInterface && ( combinedRedraw & REDRAW_GAMEAREA_ANIMATION ) ) ) {
         _gameArea.Redraw( fheroes2::Display::instance(), LEVEL_ALL );
 
         if ( hideInterface && conf.ShowControlPanel() ) {
             _controlPanel._redraw();
         }
     }
+    else if ( combinedRedraw & REDRAW_GAMEAREA_ANIMATION ) {
+        std::vector<fheroes2::Rect> updatedAreas = _gameArea.redrawAnimation( fheroes2::Display::instance(), LEVEL_ALL );
+
+        if ( isPartialRender ) {
+            // Each updated area is rendered separately to avoid rendering of the unchanged parts of the display between them.
+            if ( _isPartialRenderPlanned ) {
+                _partialRenderAreas.insert( _partialRenderAreas.end(), updatedAreas.begin(), updatedAreas.end() );
+            }
+            else {
+                _partialRenderAreas = std::move( updatedAreas );
+            }
+
+            _isPartialRenderPlanned = true;
+        }
+    }
 
     if ( ( hideInterface && conf.ShowRadar() ) || ( combinedRedraw & ( REDRAW_RADAR_CURSOR | REDRAW_RADAR ) ) ) {
         // Redraw radar map only if `REDRAW_RADAR` is set.
@@ -25,14 +25,23 @@
 
 #include <algorithm>
 #include <cctype>
+#include <condition_variable>
 #include <cstdint>
 #include <ctime>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include "campaign_savedata.h"
 #include "campaign_scenariodata.h"
 #include "dialog.h"
+#include "dir.h"
 #include "game.h"
 #include "game_language.h"
 #include "game_over.h"
@@ -42,6 +51,7 @@
 #include "serialize.h"
 #include "settings.h"
 #include "system.h"
+#include "thread.h"
 #include "translations.h"
 #include "ui_dialog.h"
 #include "ui_font.h"
@@ -55,7 +65,13 @@ namespace
 
     const uint16_t saveFileMagicNumber{ 0xFF03 };
 
-    uint16_t versionOfCurrentSaveFile = CURRENT_FORMAT_VERSION;
+    const std::string saveFileIndexExtension{ ".idx" };
+
+    const uint16_t saveFileIndexMagicNumber{ 0xFF04 };
+
+    // Save file headers are read by multiple threads simultaneously when the save file index is being updated, and each of them
+    // needs its own version of the file being read
+    thread_local uint16_t versionOfCurrentSaveFile = CURRENT_FORMAT_VERSION;
 
     std::string lastSaveName;
 
@@ -99,6 +115,348 @@ namespace
     {
         return stream >> hdr.requirements >> hdr.info >> hdr.gameType;
     }
+
+    // Information about the save file stored in the save file index
+    struct SaveFileIndexEntry final
+    {
+        uint64_t fileSize{ 0 };
+        int64_t modificationTime{ 0 };
+
+        // Whether this file is a save file supported by the current version of the game
+        bool isValid{ false };
+
+        int gameType{ 0 };
+
+        Maps::FileInfo fileInfo;
+    };
+
+    OStreamBase & operator<<( OStreamBase & stream, const SaveFileIndexEntry & entry )
+    {
+        const uint64_t modificationTime = static_cast<uint64_t>( entry.modificationTime );
+
+        stream.put32( static_cast<uint32_t>( entry.fileSize >> 32 ) );
+        stream.put32( static_cast<uint32_t>( entry.fileSize & 0xFFFFFFFF ) );
+        stream.put32( static_cast<uint32_t>( modificationTime >> 32 ) );
+        stream.put32( static_cast<uint32_t>( modificationTime & 0xFFFFFFFF ) );
+
+        return stream << entry.isValid << entry.gameType << entry.fileInfo;
+    }
+
+    IStreamBase & operator>>( IStreamBase & stream, SaveFileIndexEntry & entry )
+    {
+        entry.fileSize = static_cast<uint64_t>( stream.get32() ) << 32;
+        entry.fileSize |= stream.get32();
+
+        uint64_t modificationTime = static_cast<uint64_t>( stream.get32() ) << 32;
+        modificationTime |= stream.get32();
+
+        entry.modificationTime = static_cast<int64_t>( modificationTime );
+
+        return stream >> entry.isValid >> entry.gameType >> entry.fileInfo;
+    }
+
+    // Save file index: information about save files with the given extension, the key is the name of the file
+    using SaveFileIndex = std::map<std::string, SaveFileIndexEntry>;
+
+    std::string getSaveFileIndexPath( const std::string & saveFileExtension )
+    {
+        return System::concatPath( Game::GetSaveDir(), "index" + saveFileExtension + saveFileIndexExtension );
+    }
+
+    SaveFileIndex readSaveFileIndex( const std::string & indexFilePath )
+    {
+        StreamFile fileStream;
+        fileStream.setBigendian( true );
+
+        if ( !fileStream.open( indexFilePath, "rb" ) ) {
+            return {};
+        }
+
+        uint16_t magicNumber = 0;
+        uint16_t indexVersion = 0;
+
+        fileStream >> magicNumber >> indexVersion;
+
+        // The index is always rebuilt from scratch if it was written by a different version of the game
+        if ( fileStream.fail() || magicNumber != saveFileIndexMagicNumber || indexVersion != CURRENT_FORMAT_VERSION ) {
+            return {};
+        }
+
+        Game::SetVersionOfCurrentSaveFile( CURRENT_FORMAT_VERSION );
+
+        SaveFileIndex index;
+        fileStream >> index;
+
+        if ( fileStream.fail() ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Error reading the save file index " << indexFilePath )
+            return {};
+        }
+
+        return index;
+    }
+
+    void writeSaveFileIndex( const std::string & indexFilePath, const SaveFileIndex & index )
+    {
+        StreamFile fileStream;
+        fileStream.setBigendian( true );
+
+        if ( !fileStream.open( indexFilePath, "wb" ) ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << indexFilePath )
+            return;
+        }
+
+        fileStream << saveFileIndexMagicNumber << CURRENT_FORMAT_VERSION << index;
+
+        if ( fileStream.fail() ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Error writing the save file index " << indexFilePath )
+
+            fileStream.close();
+
+            // A partially written index will be discarded anyway
+            System::Unlink( indexFilePath );
+        }
+    }
+
+    // Reads the header of the save file and fills in the corresponding fields of the given index entry. This function can be called
+    // from multiple threads simultaneously for different files.
+    void readSaveFileHeader( const std::string & filePath, SaveFileIndexEntry & entry )
+    {
+        DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
+
+        entry.isValid = false;
+
+        StreamFile fs;
+        fs.setBigendian( true );
+
+        if ( !fs.open( filePath, "rb" ) ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << filePath )
+            return;
+        }
+
+        uint16_t magicNumber = 0;
+        fs >> magicNumber;
+
+        if ( magicNumber != saveFileMagicNumber ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Invalid file identifier in the file " << filePath )
+            return;
+        }
+
+        std::string saveFileVersionStr;
+        uint16_t saveFileVersion = 0;
+
+        fs >> saveFileVersionStr >> saveFileVersion;
+
+        DEBUG_LOG( DBG_GAME, DBG_TRACE, "Version of the file " << filePath << ": " << saveFileVersion )
+
+        if ( saveFileVersion > CURRENT_FORMAT_VERSION || saveFileVersion < LAST_SUPPORTED_FORMAT_VERSION ) {
+            return;
+        }
+
+        Game::SetVersionOfCurrentSaveFile( saveFileVersion );
+
+        HeaderSAV header;
+        fs >> header;
+
+        if ( fs.fail() ) {
+            return;
+        }
+
+        entry.isValid = true;
+        entry.gameType = header.gameType;
+        entry.fileInfo = std::move( header.info );
+    }
+
+    // Serializes the game state to the given stream. Returns true on success and false on error.
+    bool writeGameData( OStreamBase & stream )
+    {
+        const Settings & conf = Settings::Get();
+
+        stream << World::Get() << conf << GameOver::Result::Get();
+        if ( stream.fail() ) {
+            return false;
+        }
+
+        if ( conf.isCampaignGameType() ) {
+            stream << Campaign::CampaignSaveData::Get();
+        }
+
+        // End-of-data marker
+        stream << saveFileMagicNumber;
+
+        return !stream.fail();
+    }
+
+    // Writes the (uncompressed) header to the file, followed by the save data which is provided by the 'writeData' function and is
+    // compressed on the fly. The data is written to a temporary file first, which then replaces the target file, so an existing save
+    // file is never left in a partially written state.
+    bool writeSaveFile( const std::string & filePath, const RWStreamBuf & headerStream, const std::function<bool( OStreamBase & )> & writeData )
+    {
+        const std::string tempFilePath = filePath + ".tmp";
+
+        StreamFile fileStream;
+        fileStream.setBigendian( true );
+
+        if ( !fileStream.open( tempFilePath, "wb" ) ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << tempFilePath )
+            return false;
+        }
+
+        fileStream.putRaw( headerStream.data(), headerStream.size() );
+
+        bool isWritten = !fileStream.fail();
+
+        if ( isWritten ) {
+            Compression::ZipOutputStream dataStream( fileStream );
+            dataStream.setBigendian( true );
+
+            // The data must reach the storage device before the file replaces the existing save file
+            isWritten = writeData( dataStream ) && dataStream.finish() && fileStream.sync();
+        }
+
+        // The file must be closed before it is renamed or removed
+        if ( !fileStream.close() || !isWritten ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Error writing the file " << tempFilePath )
+
+            System::Unlink( tempFilePath );
+            StreamFile::syncFileSystem();
+            return false;
+        }
+
+        const bool isRenamed = System::Rename( tempFilePath, filePath );
+        if ( !isRenamed ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Error renaming the file " << tempFilePath << " to " << filePath )
+
+            System::Unlink( tempFilePath );
+        }
+
+        // The file system was synchronized when the file was closed, so the renaming must be synchronized separately
+        StreamFile::syncFileSystem();
+
+        return isRenamed;
+    }
+
+    // Compresses and writes autosaves in a background thread, so the game does not stall while the save file is being written.
+    // The serialization of the game state is always performed by the main thread, so the data passed to this class is a complete
+    // snapshot of the game state which is not affected by any further changes.
+    class AsyncSaveWriter final : public MultiThreading::AsyncManager
+    {
+    public:
+        void pushSave( std::string filePath, std::unique_ptr<RWStreamBuf> headerStream, std::unique_ptr<RWStreamBuf> dataStream )
+        {
+            createWorker();
+
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            // There is no point in writing an outdated save if it is going to be overwritten anyway
+            _saveQueue.erase( std::remove_if( _saveQueue.begin(), _saveQueue.end(),
+                                              [&filePath]( const SaveTask & task ) { return task.filePath == filePath; } ),
+                              _saveQueue.end() );
+
+            _saveQueue.push_back( { std::move( filePath ), std::move( headerStream ), std::move( dataStream ) } );
+
+            notifyWorker();
+        }
+
+        // Waits until all the pending saves are written and returns the paths of the save files which could not be written since
+        // the last call of this method.
+        std::vector<std::string> wait()
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+
+            _savingCompleted.wait( lock, [this]() { return _saveQueue.empty() && !_currentSave; } );
+
+            return std::exchange( _failedSaveFilePaths, {} );
+        }
+
+    private:
+        struct SaveTask
+        {
+            std::string filePath;
+            std::unique_ptr<RWStreamBuf> headerStream;
+            std::unique_ptr<RWStreamBuf> dataStream;
+        };
+
+        std::deque<SaveTask> _saveQueue;
+
+        // Save being written by the worker thread, it is modified only by the worker thread while holding the _mutex
+        std::optional<SaveTask> _currentSave;
+
+        std::condition_variable _savingCompleted;
+
+        // Paths of the save files which could not be written, they are reported to the main thread by wait()
+        std::vector<std::string> _failedSaveFilePaths;
+
+        // This method is called by the worker thread and is protected by _mutex
+        bool prepareTask() override
+        {
+            if ( _saveQueue.empty() ) {
+                return false;
+            }
+
+            _currentSave = std::move( _saveQueue.front() );
+            _saveQueue.pop_front();
+
+            return true;
+        }
+
+        // This method is called by the worker thread, but is not protected by _mutex
+        void executeTask() override
+        {
+            if ( !_currentSave ) {
+                // Nothing to do.
+                return;
+            }
+
+            bool isWritten = false;
+
+            try {
+                const RWStreamBuf & dataStream = *_currentSave->dataStream;
+
+                isWritten = writeSaveFile( _currentSave->filePath, *_currentSave->headerStream, [&dataStream]( OStreamBase & stream ) {
+                    stream.putRaw( dataStream.data(), dataStream.size() );
+
+                    return !stream.fail();
+                } );
+            }
+            catch ( ... ) {
+                // Do nothing, the error is reported below
+            }
+
+            if ( !isWritten ) {
+                ERROR_LOG( "Failed to write the save file " << _currentSave->filePath )
+            }
+
+            {
+                const std::scoped_lock<std::mutex> lock( _mutex );
+
+                if ( !isWritten ) {
+                    _failedSaveFilePaths.push_back( std::move( _currentSave->filePath ) );
+                }
+
+                _currentSave.reset();
+            }
+
+            _savingCompleted.notify_all();
+        }
+    };
+
+    AsyncSaveWriter asyncSaveWriter;
+}
+
+Game::IOInitializer::~IOInitializer()
+{
+    // Failed autosaves have already been logged by the worker thread and it is too late to show anything to the user here
+    asyncSaveWriter.wait();
+    asyncSaveWriter.stopWorker();
+}
+
+void Game::waitForAutoSaves()
+{
+    if ( asyncSaveWriter.wait().empty() ) {
+        return;
+    }
+
+    fheroes2::showStandardTextMessage( _( "Error" ), _( "There was an issue during autosaving." ), Dialog::OK );
 }
 
 bool Game::AutoSave()
@@ -110,13 +468,9 @@ bool Game::Save( const std::string & filePath, const bool autoSave /* = false */
 {
     DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
 
-    StreamFile fileStream;
-    fileStream.setBigendian( true );
-
-    if ( !fileStream.open( filePath, "wb" ) ) {
-        DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << filePath )
-        return false;
-    }
+    // The previous autosave is written in the background, so its result is only known now. Besides, it may have been written
+    // to the same file.
+    waitForAutoSaves();
 
     // Always use the latest version of the file save format
     SetVersionOfCurrentSaveFile( CURRENT_FORMAT_VERSION );
@@ -125,39 +479,44 @@ bool Game::Save( const std::string & filePath, const bool autoSave /* = false */
     // Header
     const Settings & conf = Settings::Get();
 
-    fileStream << saveFileMagicNumber << std::to_string( saveFileVersion ) << saveFileVersion
-               << HeaderSAV( conf.getCurrentMapInfo(), conf.GameType(), world.GetDay(), world.GetWeek(), world.GetMonth() );
-    if ( fileStream.fail() ) {
+    auto headerStream = std::make_unique<RWStreamBuf>();
+    headerStream->setBigendian( true );
+
+    *headerStream << saveFileMagicNumber << std::to_string( saveFileVersion ) << saveFileVersion
+                  << HeaderSAV( conf.getCurrentMapInfo(), conf.GameType(), world.GetDay(), world.GetWeek(), world.GetMonth() );
+    if ( headerStream->fail() ) {
         return false;
     }
 
-    RWStreamBuf dataStream;
-    dataStream.setBigendian( true );
+    if ( autoSave ) {
+        // The game state is serialized to memory, so the rest of the work can be done in the background
+        auto dataStream = std::make_unique<RWStreamBuf>();
+        dataStream->setBigendian( true );
 
-    dataStream << World::Get() << conf << GameOver::Result::Get();
-    if ( dataStream.fail() ) {
-        return false;
-    }
+        if ( !writeGameData( *dataStream ) ) {
+            return false;
+        }
 
-    if ( conf.isCampaignGameType() ) {
-        dataStream << Campaign::CampaignSaveData::Get();
+        asyncSaveWriter.pushSave( filePath, std::move( headerStream ), std::move( dataStream ) );
+
+        return true;
     }
 
-    // End-of-data marker
-    dataStream << saveFileMagicNumber;
-    if ( dataStream.fail() || !Compression::zipStreamBuf( dataStream, fileStream ) ) {
+    // The game state is compressed and written to the file while it is being serialized
+    if ( !writeSaveFile( filePath, *headerStream, writeGameData ) ) {
         return false;
     }
 
-    if ( !autoSave ) {
-        Game::SetLastSaveName( filePath );
-    }
+    Game::SetLastSaveName( filePath );
 
     return true;
 }
 
 fheroes2::GameMode Game::Load( const std::string & filePath )
 {
+    // Make sure that the file being loaded is not being written at the moment
+    waitForAutoSaves();
+
     DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
 
     const auto showGenericErrorMessage = []() { fheroes2::showStandardTextMessage( _( "Error" ), _( "The save file is corrupted." ), Dialog::OK ); };
@@ -223,10 +582,11 @@ fheroes2::GameMode Game::Load( const std::string & filePath )
         return fheroes2::GameMode::CANCEL;
     }
 
-    RWStreamBuf dataStream;
+    // The game state is decompressed while it is being deserialized
+    Compression::ZipInputStream dataStream( fileStream );
     dataStream.setBigendian( true );
 
-    if ( !Compression::unzipStream( fileStream, dataStream ) ) {
+    if ( dataStream.fail() ) {
         showGenericErrorMessage();
         return fheroes2::GameMode::CANCEL;
     }
@@ -297,54 +657,84 @@ fheroes2::GameMode Game::Load( const std::string & filePath )
     return returnValue;
 }
 
-bool Game::LoadSAV2FileInfo( std::string filePath, Maps::FileInfo & fileInfo )
+std::vector<Maps::FileInfo> Game::getSaveFileInfos()
 {
-    DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
+    // On some platforms the file cannot be replaced while it is open, so the pending autosave should be written first
+    asyncSaveWriter.wait();
 
-    StreamFile fs;
-    fs.setBigendian( true );
+    const std::string saveFileExtension = GetSaveFileExtension();
+    const std::string indexFilePath = getSaveFileIndexPath( saveFileExtension );
 
-    if ( !fs.open( filePath, "rb" ) ) {
-        DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << filePath )
-        return false;
-    }
+    ListFiles files;
+    files.ReadDir( GetSaveDir(), saveFileExtension );
 
-    uint16_t magicNumber = 0;
-    fs >> magicNumber;
+    SaveFileIndex index = readSaveFileIndex( indexFilePath );
+    const size_t oldIndexSize = index.size();
 
-    if ( magicNumber != saveFileMagicNumber ) {
-        DEBUG_LOG( DBG_GAME, DBG_WARN, "Invalid file identifier in the file " << filePath )
-        return false;
-    }
+    // Entries for files that are no longer present are removed from the index
+    SaveFileIndex updatedIndex;
 
-    std::string saveFileVersionStr;
-    uint16_t saveFileVersion = 0;
+    std::vector<std::pair<const std::string *, const SaveFileIndexEntry *>> saveFiles;
+    saveFiles.reserve( files.size() );
 
-    fs >> saveFileVersionStr >> saveFileVersion;
+    std::vector<std::pair<const std::string *, SaveFileIndexEntry *>> outdatedEntries;
 
-    DEBUG_LOG( DBG_GAME, DBG_TRACE, "Version of the file " << filePath << ": " << saveFileVersion )
+    for ( const std::string & filePath : files ) {
+        uint64_t fileSize = 0;
+        int64_t modificationTime = 0;
 
-    if ( saveFileVersion > CURRENT_FORMAT_VERSION || saveFileVersion < LAST_SUPPORTED_FORMAT_VERSION ) {
-        return false;
-    }
+        if ( !System::GetFileStatus( filePath, fileSize, modificationTime ) ) {
+            continue;
+        }
 
-    SetVersionOfCurrentSaveFile( saveFileVersion );
+        std::string fileName = System::GetFileName( filePath );
 
-    HeaderSAV header;
-    fs >> header;
+        auto [iter, isInserted] = updatedIndex.try_emplace( fileName );
+        if ( !isInserted ) {
+            // This can only happen if the file system returned the same file twice
+            continue;
+        }
 
-    if ( fs.fail() ) {
-        return false;
+        SaveFileIndexEntry & entry = iter->second;
+
+        saveFiles.emplace_back( &filePath, &entry );
+
+        if ( const auto cachedIter = index.find( fileName );
+             cachedIter != index.end() && cachedIter->second.fileSize == fileSize && cachedIter->second.modificationTime == modificationTime ) {
+            entry = std::move( cachedIter->second );
+            continue;
+        }
+
+        entry.fileSize = fileSize;
+        entry.modificationTime = modificationTime;
+
+        outdatedEntries.emplace_back( &filePath, &entry );
     }
 
-    if ( ( Settings::Get().GameType() & header.gameType ) == 0 ) {
-        return false;
+    // Only the headers of new and modified files have to be read
+    MultiThreading::parallelFor( outdatedEntries.size(), [&outdatedEntries]( const size_t idx ) {
+        readSaveFileHeader( *outdatedEntries[idx].first, *outdatedEntries[idx].second );
+    } );
+
+    if ( !outdatedEntries.empty() || updatedIndex.size() != oldIndexSize ) {
+        writeSaveFileIndex( indexFilePath, updatedIndex );
     }
 
-    fileInfo = std::move( header.info );
-    fileInfo.filename = std::move( filePath );
+    const int gameType = Settings::Get().GameType();
 
-    return true;
+    std::vector<Maps::FileInfo> fileInfos;
+    fileInfos.reserve( saveFiles.size() );
+
+    for ( const auto & [filePath, entry] : saveFiles ) {
+        if ( !entry->isValid || ( gameType & entry->gameType ) == 0 ) {
+            continue;
+        }
+
+        Maps::FileInfo & fileInfo = fileInfos.emplace_back( entry->fileInfo );
+        fileInfo.filename = *filePath;
+    }
+
+    return fileInfos;
 }
 
 void Game::SetVersionOfCurrentSaveFile( const uint16_t version )
@@ -25,6 +25,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "game_mode.h"
 
@@ -35,6 +36,19 @@ namespace Maps
 
 namespace Game
 {
+    // Autosaves are written to disk by a background thread. This class stops this thread on destruction, after all the pending
+    // autosaves have been written.
+    class IOInitializer
+    {
+    public:
+        IOInitializer() = default;
+        IOInitializer( const IOInitializer & ) = delete;
+
+        ~IOInitializer();
+
+        IOInitializer & operator=( const IOInitializer & ) = delete;
+    };
+
     const std::string & GetLastSaveName();
     void SetLastSaveName( const std::string & name );
 
@@ -49,10 +63,16 @@ namespace Game
     bool AutoSave();
     bool Save( const std::string & filePath, const bool autoSave = false );
 
+    // Waits until the autosaves being written in the background are completed and shows an error message if any of them could not be
+    // written. Must be called by the main thread.
+    void waitForAutoSaves();
+
     // Returns GameMode::CANCEL in case of failure.
     fheroes2::GameMode Load( const std::string & filePath );
 
-    bool LoadSAV2FileInfo( std::string filePath, Maps::FileInfo & fileInfo );
+    // Returns information about all the save files of the current game type in the save directory. The headers of save files are
+    // cached in an index file in the same directory, so only new or modified save files have to be read.
+    std::vector<Maps::FileInfo> getSaveFileInfos();
 
     bool SaveCompletedCampaignScenario();
 }
@@ -26,6 +26,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -44,6 +45,7 @@
 #include "game_delays.h"
 #include "game_hotkeys.h"
 #include "game_interface.h"
+#include "game_io.h"
 #include "game_mainmenu_ui.h"
 #include "game_mode.h"
 #include "icn.h"
@@ -108,9 +110,22 @@ void Game::mainGameLoop( bool isFirstGameRun, bool isProbablyDemoVersion )
 
     bool exit = false;
 
+    // Large images of the main menu screens are not needed while the game is being played
+    std::optional<fheroes2::AGG::ScreenImagesScope> menuImagesScope;
+
     while ( !exit ) {
+        if ( result == fheroes2::GameMode::START_GAME ) {
+            menuImagesScope.reset();
+        }
+        else if ( !menuImagesScope ) {
+            menuImagesScope.emplace();
+        }
+
         switch ( result ) {
         case fheroes2::GameMode::QUIT_GAME:
+            // Let the user know if the last autosave could not be written
+            Game::waitForAutoSaves();
+
             exit = true;
             break;
         case fheroes2::GameMode::MAIN_MENU:
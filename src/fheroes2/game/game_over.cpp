@@ -36,6 +36,7 @@
 #include "castle.h"
 #include "dialog.h"
 #include "game.h"
+#include "game_benchmark.h"
 #include "game_io.h"
 #include "game_video.h"
 #include "game_video_type.h"
@@ -414,6 +415,17 @@ void GameOver::Result::Reset()
 
 fheroes2::GameMode GameOver::Result::checkGameOver()
 {
+    if ( Benchmark::isHeadlessMode() ) {
+        // All players are controlled by AI and nobody is there to be notified: the game goes on until only one kingdom remains.
+        for ( const PlayerColor color : PlayerColorsVector( _colors ) ) {
+            if ( !world.GetKingdom( color ).isPlay() ) {
+                _colors &= ~color;
+            }
+        }
+
+        return ( Color::Count( _colors ) > 1 ) ? fheroes2::GameMode::CANCEL : fheroes2::GameMode::MAIN_MENU;
+    }
+
     const PlayerColorsSet humanColors = Players::HumanColors();
     const bool isSinglePlayer = ( Color::Count( humanColors ) == 1 );
 
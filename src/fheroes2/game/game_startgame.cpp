@@ -51,6 +51,7 @@
 #include "game_io.h"
 #include "game_mode.h"
 #include "game_over.h"
+#include "game_turn_profiler.h"
 #include "heroes.h"
 #include "icn.h"
 #include "image.h"
@@ -77,6 +78,7 @@
 #include "resource.h"
 #include "screen.h"
 #include "settings.h"
+#include "timing.h"
 #include "tools.h"
 #include "translations.h"
 #include "ui_dialog.h"
@@ -291,6 +293,9 @@ void Game::OpenCastleDialog( Castle & castle, bool updateFocus /* = true */, con
     // setup cursor
     const CursorRestorer cursorRestorer( true, Cursor::POINTER );
 
+    // Large images of the castle screen are released once it is closed
+    const fheroes2::AGG::ScreenImagesScope screenImagesScope;
+
     // Stop all sounds, but not the music - it will be replaced by the music of the castle
     AudioManager::stopSounds();
 
@@ -761,8 +766,13 @@ fheroes2::GameMode Interface::AdventureMap::StartGame()
     }
 
     while ( res == fheroes2::GameMode::END_TURN ) {
+        const fheroes2::Time dayTimer;
+        double newDayTime = 0;
+
         if ( !isLoadedFromSave ) {
             world.NewDay();
+
+            newDayTime = dayTimer.getS();
         }
 
         // Check if the game is over at the beginning of a new day
@@ -889,7 +899,16 @@ fheroes2::GameMode Interface::AdventureMap::StartGame()
                     }
 #endif
 
-                    res = AI::Planner::Get().KingdomTurn( kingdom );
+                    {
+                        const fheroes2::Time turnTimer;
+
+                        TurnProfiler::reset();
+
+                        res = AI::Planner::Get().KingdomTurn( kingdom );
+
+                        TurnProfiler::logKingdomTurn( playerColor, turnTimer.getS() );
+                    }
+
                     // This function must return only game state related values.
                     assert( res != fheroes2::GameMode::CANCEL );
 
@@ -926,6 +945,8 @@ fheroes2::GameMode Interface::AdventureMap::StartGame()
             isLoadedFromSave = false;
         }
 
+        TurnProfiler::logDay( world.CountDay(), dayTimer.getS(), newDayTime );
+
         // We went through all the players, but the current player from the save file is still not found,
         // something is clearly wrong here
         if ( skipTurns ) {
@@ -1512,7 +1533,7 @@ fheroes2::GameMode Interface::AdventureMap::HumanTurn( const bool isLoadedFromSa
         if ( Game::validateAnimationDelay( Game::MAPS_DELAY ) ) {
             Game::updateAdventureMapAnimationIndex();
 
-            _gameArea.SetRedraw();
+            setRedraw( REDRAW_GAMEAREA_ANIMATION );
         }
 
         if ( needRedraw() ) {
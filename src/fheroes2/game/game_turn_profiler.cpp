@@ -0,0 +1,138 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2025                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "game_turn_profiler.h"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include "color.h"
+#include "game_benchmark.h"
+#include "logging.h"
+
+namespace
+{
+    // Pathfinding can be performed in several threads at once, so the counters have to be atomic
+    std::array<std::atomic<uint64_t>, static_cast<size_t>( TurnProfiler::Phase::PHASE_COUNT )> phaseTimeUs{};
+
+    const char * getPhaseName( const TurnProfiler::Phase phase )
+    {
+        switch ( phase ) {
+        case TurnProfiler::Phase::CASTLES:
+            return "castles";
+        case TurnProfiler::Phase::HEROES:
+            return "heroes";
+        case TurnProfiler::Phase::PATHFINDING:
+            return "pathfinding";
+        case TurnProfiler::Phase::BATTLES:
+            return "battles";
+        default:
+            assert( 0 );
+            break;
+        }
+
+        return "unknown";
+    }
+
+    void writeToLog( const std::string & message )
+    {
+        // The headless benchmark reports its results regardless of the logging level and of the build type.
+        if ( Benchmark::isHeadlessMode() ) {
+            COUT( message )
+            return;
+        }
+
+        DEBUG_LOG( DBG_AI, DBG_INFO, message )
+    }
+}
+
+namespace TurnProfiler
+{
+    PhaseTimer::PhaseTimer( const Phase phase )
+        : _phase( phase )
+    {
+        assert( _phase < Phase::PHASE_COUNT );
+
+        if ( isEnabled() ) {
+            _timer.emplace();
+        }
+    }
+
+    PhaseTimer::~PhaseTimer()
+    {
+        if ( !_timer ) {
+            return;
+        }
+
+        phaseTimeUs[static_cast<size_t>( _phase )] += static_cast<uint64_t>( _timer->getS() * 1000000 );
+    }
+
+    bool isEnabled()
+    {
+        if ( Benchmark::isHeadlessMode() ) {
+            return true;
+        }
+
+#if defined( WITH_DEBUG )
+        return IS_DEBUG( DBG_AI, DBG_INFO );
+#else
+        return false;
+#endif
+    }
+
+    void reset()
+    {
+        for ( std::atomic<uint64_t> & timeUs : phaseTimeUs ) {
+            timeUs = 0;
+        }
+    }
+
+    void logKingdomTurn( const PlayerColor color, const double turnTime )
+    {
+        if ( !isEnabled() ) {
+            return;
+        }
+
+        std::ostringstream os;
+        os << Color::String( color ) << " turn time: " << turnTime << " s";
+
+        for ( size_t i = 0; i < phaseTimeUs.size(); ++i ) {
+            os << ", " << getPhaseName( static_cast<Phase>( i ) ) << ": " << static_cast<double>( phaseTimeUs[i] ) / 1000000 << " s";
+        }
+
+        writeToLog( os.str() );
+    }
+
+    void logDay( const uint32_t day, const double dayTime, const double newDayTime )
+    {
+        if ( !isEnabled() ) {
+            return;
+        }
+
+        std::ostringstream os;
+        os << "day " << day << " time: " << dayTime << " s, new day: " << newDayTime << " s";
+
+        writeToLog( os.str() );
+    }
+}
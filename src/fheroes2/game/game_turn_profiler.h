@@ -0,0 +1,76 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2025                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "timing.h"
+
+enum class PlayerColor : uint8_t;
+
+// Measures the time spent by AI kingdoms in various phases of their turns. Measurements are performed in the headless benchmark
+// mode (see Benchmark::run()) and in debug builds when the AI information logging is enabled. The results are written to the log
+// after the turn of each AI kingdom.
+namespace TurnProfiler
+{
+    enum class Phase : int
+    {
+        CASTLES,
+        HEROES,
+        PATHFINDING,
+        BATTLES,
+
+        // Put all new entries above this line.
+        PHASE_COUNT
+    };
+
+    // Adds the time elapsed between the construction and destruction of this object to the total time of the given phase.
+    // Phases can be nested (for example, pathfinding is performed during the heroes turn), in which case the time of the
+    // inner phase is also included in the time of the outer phase.
+    class PhaseTimer
+    {
+    public:
+        explicit PhaseTimer( const Phase phase );
+        PhaseTimer( const PhaseTimer & ) = delete;
+
+        ~PhaseTimer();
+
+        PhaseTimer & operator=( const PhaseTimer & ) = delete;
+
+    private:
+        // The timer is created only if the profiling is enabled.
+        std::optional<fheroes2::Time> _timer;
+
+        const Phase _phase;
+    };
+
+    bool isEnabled();
+
+    // Resets the total time of all phases.
+    void reset();
+
+    // Writes the total time of all phases since the last reset, as well as the total turn time, to the log.
+    void logKingdomTurn( const PlayerColor color, const double turnTime );
+
+    // Writes the total time of the day as well as the time spent on the start of the new day to the log.
+    void logDay( const uint32_t day, const double dayTime, const double newDayTime );
+}
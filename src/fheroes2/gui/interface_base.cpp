@@ -39,13 +39,27 @@ namespace Interface
 
     void Interface::BaseInterface::validateFadeInAndRender()
     {
+        fheroes2::Display & display = fheroes2::Display::instance();
+
         if ( Game::validateDisplayFadeIn() ) {
             fheroes2::fadeInDisplay();
 
             setRedraw( REDRAW_GAMEAREA );
         }
+        else if ( _isPartialRenderPlanned && display.renderCounter() == _lastRenderCounter ) {
+            // Nothing has been rendered since the previous frame of the interface, so nothing but the redrawn parts of the game area
+            // can differ from what is on the screen.
+            display.render( _partialRenderAreas );
+        }
         else {
-            fheroes2::Display::instance().render();
+            // Something else (a dialog, a popup, a button or anything drawn directly on the display) could have changed the display,
+            // so the whole display must be rendered.
+            display.render();
         }
+
+        _lastRenderCounter = display.renderCounter();
+
+        _isPartialRenderPlanned = false;
+        _partialRenderAreas.clear();
     }
 }
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "game_mode.h"
 #include "interface_gamearea.h"
@@ -56,7 +57,10 @@ namespace Interface
         REDRAW_ALL = 0x1FF,
 
         // This option is only for the Editor.
-        REDRAW_PASSABILITIES = 0x200
+        REDRAW_PASSABILITIES = 0x200,
+
+        // To render only animated and changed parts of the game area. This option is only for the game (Adventure Map) interface.
+        REDRAW_GAMEAREA_ANIMATION = 0x400
     };
 
     class BaseInterface
@@ -157,6 +161,13 @@ namespace Interface
 
         uint32_t _redraw{ 0 };
 
+        // The areas of the display to be rendered when only parts of the game area were redrawn and nothing else was changed.
+        std::vector<fheroes2::Rect> _partialRenderAreas;
+        bool _isPartialRenderPlanned{ false };
+
+        // The display render counter right after the previous frame of the interface was rendered.
+        uint32_t _lastRenderCounter{ 0 };
+
         const bool _isEditor{ false };
     };
 }
@@ -25,12 +25,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdlib>
 #include <deque>
 #include <list>
 #include <map>
 #include <ostream>
 #include <type_traits>
+#include <vector>
 
 #include "agg_image.h"
 #include "castle.h"
@@ -46,10 +48,12 @@
 #include "interface_cpanel.h"
 #include "localevent.h"
 #include "logging.h"
+#include "map_object_info.h"
 #include "maps.h"
 #include "maps_tiles.h"
 #include "maps_tiles_helper.h"
 #include "maps_tiles_render.h"
+#include "math_tools.h"
 #include "pal.h"
 #include "players.h"
 #include "route.h"
@@ -321,6 +325,223 @@ namespace
 
         return false;
     }
+
+    // Partial rendering of the game area is done by blocks of tiles to reduce the number of rendering calls.
+    const int32_t partialRenderBlockSize = 4;
+
+    // Tile-unfit objects are bigger than a tile so they are searched beyond the rendered tile area: 1 tile to the left and top, 2 tiles to the right and bottom.
+    const int32_t tileUnfitObjectMarginLeftTop = 1;
+    const int32_t tileUnfitObjectMarginRightBottom = 2;
+
+    uint64_t addToSignature( const uint64_t signature, const uint64_t value )
+    {
+        // FNV-1a like mixing is good enough to detect changes of a tile content.
+        return ( signature ^ value ) * 0x100000001B3ULL;
+    }
+
+    uint64_t addToSignature( const uint64_t signature, const Maps::ObjectPart & part )
+    {
+        return addToSignature( addToSignature( signature, part._uid ),
+                               ( static_cast<uint64_t>( part.layerType ) << 16 ) | ( static_cast<uint64_t>( part.icnType ) << 8 ) | part.icnIndex );
+    }
+
+    uint64_t getTileSignature( const Maps::Tile & tile )
+    {
+        uint64_t signature = 0xCBF29CE484222325ULL;
+
+        signature = addToSignature( signature, tile.getMainObjectType() );
+        signature = addToSignature( signature, tile.getMainObjectPart() );
+
+        for ( const auto & part : tile.getGroundObjectParts() ) {
+            signature = addToSignature( signature, part );
+        }
+
+        for ( const auto & part : tile.getTopObjectParts() ) {
+            signature = addToSignature( signature, part );
+        }
+
+        signature = addToSignature( signature, tile.getFogDirection() );
+        signature = addToSignature( signature, tile.getTerrainImageIndex() );
+        signature = addToSignature( signature, ( static_cast<uint64_t>( tile.getTerrainFlags() ) << 8 ) | ( tile.isRoad() ? 1 : 0 ) );
+
+        for ( const uint32_t value : tile.metadata() ) {
+            signature = addToSignature( signature, value );
+        }
+
+        return signature;
+    }
+
+    uint64_t getRouteSignature( const Heroes * hero )
+    {
+        if ( hero == nullptr ) {
+            return 0;
+        }
+
+        const Route::Path & path = hero->GetPath();
+
+        uint64_t signature = 0xCBF29CE484222325ULL;
+
+        signature = addToSignature( signature, hero->GetID() );
+        signature = addToSignature( signature, hero->GetDirection() );
+        signature = addToSignature( signature, hero->isMoveEnabled() ? 1 : 0 );
+        signature = addToSignature( signature, hero->GetLevelSkill( Skill::Secondary::PATHFINDING ) );
+
+        if ( !path.isShow() ) {
+            return signature;
+        }
+
+        signature = addToSignature( signature, static_cast<uint64_t>( path.GetAllowedSteps() ) + 1 );
+
+        for ( const Route::Step & step : path ) {
+            signature = addToSignature( signature, static_cast<uint32_t>( step.GetIndex() ) );
+            signature = addToSignature( signature, static_cast<uint32_t>( step.GetDirection() ) );
+        }
+
+        return signature;
+    }
+
+    // Returns true if the object on the tile is rendered as a tile-unfit object which is animated or its appearance depends on other tiles.
+    bool isDynamicTileUnfitObject( const Maps::Tile & tile, const bool isTileUnderFog )
+    {
+        switch ( tile.getMainObjectType() ) {
+        case MP2::OBJ_HERO:
+        case MP2::OBJ_BOAT:
+            return true;
+        case MP2::OBJ_MONSTER:
+            return !isTileUnderFog;
+        default:
+            break;
+        }
+
+        const MP2::MapObjectType objectType = tile.getMainObjectType( false );
+
+        // Flying ghosts over Haunted and Abandoned Mines.
+        return objectType == MP2::OBJ_ABANDONED_MINE || ( objectType == MP2::OBJ_MINE && Maps::getMineSpellIdFromTile( tile ) == Spell::HAUNT );
+    }
+
+    // Returns the area of tiles which objects can be rendered within the given tile area. The state of these tiles is stored to detect changes.
+    fheroes2::Rect getTrackedTileROI( const fheroes2::Rect & tileROI )
+    {
+        return { tileROI.x - tileUnfitObjectMarginLeftTop, tileROI.y - tileUnfitObjectMarginLeftTop,
+                 tileROI.width + tileUnfitObjectMarginLeftTop + tileUnfitObjectMarginRightBottom,
+                 tileROI.height + tileUnfitObjectMarginLeftTop + tileUnfitObjectMarginRightBottom };
+    }
+
+    int32_t getTileCoordinate( const int32_t pixelOffset )
+    {
+        // Images placed to the left or to the top of a tile have negative offsets which must be rounded down.
+        return pixelOffset >= 0 ? pixelOffset / fheroes2::tileWidthPx : -( ( fheroes2::tileWidthPx - 1 - pixelOffset ) / fheroes2::tileWidthPx );
+    }
+
+    // Extends the area in tiles by the area of an image in pixels. Both areas are relative to the same tile.
+    void addImageToTileArea( fheroes2::Rect & tileArea, const fheroes2::Rect & imageRoi )
+    {
+        if ( imageRoi.width <= 0 || imageRoi.height <= 0 ) {
+            return;
+        }
+
+        const int32_t minX = getTileCoordinate( imageRoi.x );
+        const int32_t minY = getTileCoordinate( imageRoi.y );
+        const int32_t maxX = getTileCoordinate( imageRoi.x + imageRoi.width - 1 );
+        const int32_t maxY = getTileCoordinate( imageRoi.y + imageRoi.height - 1 );
+
+        tileArea = fheroes2::getBoundaryRect( tileArea, { minX, minY, maxX - minX + 1, maxY - minY + 1 } );
+    }
+
+    void addSpriteToTileArea( fheroes2::Rect & tileArea, const fheroes2::Sprite & sprite )
+    {
+        addImageToTileArea( tileArea, { sprite.x(), sprite.y(), sprite.width(), sprite.height() } );
+    }
+
+    void addImagesToTileArea( fheroes2::Rect & tileArea, const std::vector<fheroes2::ObjectRenderingInfo> & images )
+    {
+        for ( const auto & info : images ) {
+            const int32_t offsetX = info.tileOffset.x * fheroes2::tileWidthPx + info.imageOffset.x;
+            const int32_t offsetY = info.tileOffset.y * fheroes2::tileWidthPx + info.imageOffset.y;
+            addImageToTileArea( tileArea, { offsetX, offsetY, info.area.width, info.area.height } );
+        }
+    }
+
+    // Returns the area in tiles relative to the given tile which is covered by the images rendered for the objects on this tile.
+    fheroes2::Rect getTileImageArea( const Maps::Tile & tile, const bool isEditor )
+    {
+        fheroes2::Rect tileArea{ 0, 0, 1, 1 };
+
+        switch ( tile.getMainObjectType() ) {
+        case MP2::OBJ_HERO:
+            if ( isEditor ) {
+                addImagesToTileArea( tileArea, Maps::getEditorHeroSpritesPerTile( tile ) );
+            }
+            else if ( const Heroes * hero = tile.getHero(); hero != nullptr ) {
+                addImagesToTileArea( tileArea, Maps::getHeroSpritesPerTile( *hero ) );
+                addImagesToTileArea( tileArea, Maps::getHeroShadowSpritesPerTile( *hero ) );
+            }
+            break;
+        case MP2::OBJ_MONSTER:
+            addImagesToTileArea( tileArea, Maps::getMonsterSpritesPerTile( tile, isEditor ) );
+            addImagesToTileArea( tileArea, Maps::getMonsterShadowSpritesPerTile( tile, isEditor ) );
+            break;
+        case MP2::OBJ_BOAT:
+            addImagesToTileArea( tileArea, Maps::getBoatSpritesPerTile( tile ) );
+            addImagesToTileArea( tileArea, Maps::getBoatShadowSpritesPerTile( tile ) );
+            break;
+        default:
+            break;
+        }
+
+        const MP2::MapObjectType objectType = tile.getMainObjectType( false );
+        if ( objectType == MP2::OBJ_ABANDONED_MINE || ( objectType == MP2::OBJ_MINE && Maps::getMineSpellIdFromTile( tile ) == Spell::HAUNT ) ) {
+            // Flying ghosts are animated so the images of all frames are taken into account.
+            const uint32_t ghostFrameCount = fheroes2::AGG::GetICNCount( ICN::OBJNHAUN );
+            for ( uint32_t i = 0; i < ghostFrameCount; ++i ) {
+                addSpriteToTileArea( tileArea, fheroes2::AGG::GetICN( ICN::OBJNHAUN, i ) );
+            }
+        }
+        else if ( objectType == MP2::OBJ_MINE ) {
+            addImagesToTileArea( tileArea, Maps::getMineGuardianSpritesPerTile( tile ) );
+        }
+
+        // Flags are the only tile-fit object parts which images can be outside their tiles.
+        const auto addFlagImage = [&tileArea]( const Maps::ObjectPart & part ) {
+            if ( part.icnType == MP2::OBJ_ICN_TYPE_FLAG32 ) {
+                addSpriteToTileArea( tileArea, fheroes2::AGG::GetICN( MP2::getIcnIdFromObjectIcnType( part.icnType ), part.icnIndex ) );
+            }
+        };
+
+        addFlagImage( tile.getMainObjectPart() );
+
+        for ( const auto & part : tile.getGroundObjectParts() ) {
+            addFlagImage( part );
+        }
+
+        for ( const auto & part : tile.getTopObjectParts() ) {
+            addFlagImage( part );
+        }
+
+        return tileArea;
+    }
+
+    bool isAnimatedObjectPart( const Maps::ObjectPart & part )
+    {
+        if ( part.icnType == MP2::OBJ_ICN_TYPE_UNKNOWN ) {
+            return false;
+        }
+
+        const auto * objectInfo = Maps::getObjectPartByIcn( part.icnType, part.icnIndex );
+        return objectInfo != nullptr && objectInfo->animationFrames > 0;
+    }
+
+    bool hasAnimatedTileFitObject( const Maps::Tile & tile )
+    {
+        if ( isAnimatedObjectPart( tile.getMainObjectPart() ) ) {
+            return true;
+        }
+
+        const auto isAnimated = []( const Maps::ObjectPart & part ) { return isAnimatedObjectPart( part ); };
+
+        return std::any_of( tile.getGroundObjectParts().begin(), tile.getGroundObjectParts().end(), isAnimated )
+               || std::any_of( tile.getTopObjectParts().begin(), tile.getTopObjectParts().end(), isAnimated );
+    }
 }
 
 Interface::GameArea::GameArea( BaseInterface & interface )
@@ -375,7 +596,7 @@ void Interface::GameArea::BlitOnTile( fheroes2::Image & dst, const fheroes2::Ima
     const fheroes2::Point tileOffset = GetRelativeTilePosition( mp );
 
     const fheroes2::Rect imageRoi{ tileOffset.x + ox, tileOffset.y + oy, src.width(), src.height() };
-    const fheroes2::Rect overlappedRoi = _windowROI ^ imageRoi;
+    const fheroes2::Rect overlappedRoi = _getRenderClipROI() ^ imageRoi;
 
     fheroes2::AlphaBlit( src, overlappedRoi.x - imageRoi.x, overlappedRoi.y - imageRoi.y, dst, overlappedRoi.x, overlappedRoi.y, overlappedRoi.width,
                          overlappedRoi.height, alpha, flip );
@@ -387,7 +608,7 @@ void Interface::GameArea::BlitOnTile( fheroes2::Image & dst, const fheroes2::Ima
     const fheroes2::Point tileOffset = GetRelativeTilePosition( mp );
 
     const fheroes2::Rect imageRoi{ tileOffset.x + ox, tileOffset.y + oy, srcRoi.width, srcRoi.height };
-    const fheroes2::Rect overlappedRoi = _windowROI ^ imageRoi;
+    const fheroes2::Rect overlappedRoi = _getRenderClipROI() ^ imageRoi;
 
     fheroes2::AlphaBlit( src, srcRoi.x + overlappedRoi.x - imageRoi.x, srcRoi.y + overlappedRoi.y - imageRoi.y, dst, overlappedRoi.x, overlappedRoi.y,
                          overlappedRoi.width, overlappedRoi.height, alpha, flip );
@@ -398,15 +619,244 @@ void Interface::GameArea::DrawTile( fheroes2::Image & dst, const fheroes2::Image
     const fheroes2::Point tileOffset = GetRelativeTilePosition( mp );
 
     const fheroes2::Rect imageRoi{ tileOffset.x, tileOffset.y, src.width(), src.height() };
-    const fheroes2::Rect overlappedRoi = _windowROI ^ imageRoi;
+    const fheroes2::Rect overlappedRoi = _getRenderClipROI() ^ imageRoi;
 
     fheroes2::Copy( src, overlappedRoi.x - imageRoi.x, overlappedRoi.y - imageRoi.y, dst, overlappedRoi.x, overlappedRoi.y, overlappedRoi.width, overlappedRoi.height );
 }
 
 void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzleDraw ) const
 {
-    const fheroes2::Rect & tileROI = GetVisibleTileROI();
+    const fheroes2::Rect tileROI = GetVisibleTileROI();
+
+    _redraw( dst, flag, isPuzzleDraw, tileROI );
+
+    if ( isPuzzleDraw ) {
+        if ( &dst == _renderedState.output ) {
+            // The image does not correspond to the saved state anymore.
+            _renderedState.output = nullptr;
+        }
+    }
+    else {
+        _saveRenderedState( dst, flag, tileROI );
+    }
 
+    updateObjectAnimationInfo();
+}
+
+std::vector<fheroes2::Rect> Interface::GameArea::redrawAnimation( fheroes2::Image & dst, const int flag ) const
+{
+    const fheroes2::Rect tileROI = GetVisibleTileROI();
+    const bool drawHeroes = ( flag & LEVEL_HEROES ) == LEVEL_HEROES;
+
+    // Fading animations change the whole object image so it is easier to render everything.
+    const bool isStateChanged = _renderedState.output != &dst || _renderedState.windowROI != _windowROI
+                                || _renderedState.topLeftTileOffset != _topLeftTileOffset || _renderedState.tileROI != tileROI || _renderedState.flag != flag;
+    if ( isStateChanged || !_animationInfo.empty() || _renderedState.routeSignature != getRouteSignature( drawHeroes ? GetFocusHeroes() : nullptr ) ) {
+        Redraw( dst, flag );
+        return { _windowROI };
+    }
+
+#ifdef WITH_DEBUG
+    const bool renderFog = ( ( flag & LEVEL_FOG ) == LEVEL_FOG ) && !IS_DEVEL();
+#else
+    const bool renderFog = ( flag & LEVEL_FOG ) == LEVEL_FOG;
+#endif
+
+    const int32_t worldWidth = world.w();
+    const int32_t worldHeight = world.h();
+    const bool isEditor = _interface.isEditor();
+
+    const int32_t blockCountX = ( tileROI.width + partialRenderBlockSize - 1 ) / partialRenderBlockSize;
+    const int32_t blockCountY = ( tileROI.height + partialRenderBlockSize - 1 ) / partialRenderBlockSize;
+
+    std::vector<uint8_t> dirtyBlocks( static_cast<size_t>( blockCountX ) * blockCountY, 0 );
+
+    // Marks all blocks which cover the given area of tiles relative to the given tile and are within the visible area.
+    const auto markTiles = [&tileROI, blockCountX, &dirtyBlocks]( const int32_t x, const int32_t y, const fheroes2::Rect & tileArea ) {
+        const int32_t fromX = std::max( x + tileArea.x - tileROI.x, 0 );
+        const int32_t fromY = std::max( y + tileArea.y - tileROI.y, 0 );
+        const int32_t toX = std::min( x + tileArea.x + tileArea.width - 1 - tileROI.x, tileROI.width - 1 );
+        const int32_t toY = std::min( y + tileArea.y + tileArea.height - 1 - tileROI.y, tileROI.height - 1 );
+        if ( fromX > toX || fromY > toY ) {
+            return;
+        }
+
+        for ( int32_t blockY = fromY / partialRenderBlockSize; blockY <= toY / partialRenderBlockSize; ++blockY ) {
+            for ( int32_t blockX = fromX / partialRenderBlockSize; blockX <= toX / partialRenderBlockSize; ++blockX ) {
+                dirtyBlocks[blockY * blockCountX + blockX] = 1;
+            }
+        }
+    };
+
+    const fheroes2::Rect trackedROI = getTrackedTileROI( tileROI );
+
+    std::vector<uint64_t> & tileSignatures = _renderedState.tileSignatures;
+    std::vector<fheroes2::Rect> & tileImageAreas = _renderedState.tileImageAreas;
+    assert( tileSignatures.size() == static_cast<size_t>( trackedROI.width ) * trackedROI.height && tileImageAreas.size() == tileSignatures.size() );
+
+    // The area of tiles covered by the images of any tracked tile.
+    fheroes2::Rect maxTileImageArea{ 0, 0, 1, 1 };
+
+    const int32_t minTrackedX = std::max( trackedROI.x, 0 );
+    const int32_t maxTrackedX = std::min( trackedROI.x + trackedROI.width, worldWidth );
+
+    for ( int32_t y = std::max( trackedROI.y, 0 ); y < std::min( trackedROI.y + trackedROI.height, worldHeight ); ++y ) {
+        const int32_t trackedOffset = ( y - trackedROI.y ) * trackedROI.width - trackedROI.x;
+
+        for ( int32_t x = minTrackedX; x < maxTrackedX; ++x ) {
+            const Maps::Tile & tile = world.getTile( x, y );
+
+            const uint64_t signature = getTileSignature( tile );
+            uint64_t & savedSignature = tileSignatures[trackedOffset + x];
+            fheroes2::Rect & savedImageArea = tileImageAreas[trackedOffset + x];
+
+            const bool isTileUnderFog = renderFog && ( tile.getFogDirection() == DIRECTION_ALL );
+
+            if ( signature != savedSignature || isDynamicTileUnfitObject( tile, isTileUnderFog ) ) {
+                // Both the previous and the current images of the tile objects must be rendered again.
+                const fheroes2::Rect imageArea = getTileImageArea( tile, isEditor );
+                markTiles( x, y, fheroes2::getBoundaryRect( savedImageArea, imageArea ) );
+
+                savedSignature = signature;
+                savedImageArea = imageArea;
+            }
+            else if ( !isTileUnderFog && hasAnimatedTileFitObject( tile ) ) {
+                markTiles( x, y, { 0, 0, 1, 1 } );
+            }
+
+            maxTileImageArea = fheroes2::getBoundaryRect( maxTileImageArea, savedImageArea );
+        }
+    }
+
+    // Images of a tile reach the tiles to the right and bottom of it by the right and bottom sides of its image area and vice versa.
+    // Therefore, the rendered tiles must cover the span extended in the opposite directions.
+    const int32_t renderMarginLeft = maxTileImageArea.x + maxTileImageArea.width - 1;
+    const int32_t renderMarginTop = maxTileImageArea.y + maxTileImageArea.height - 1;
+    const int32_t renderMarginRight = -maxTileImageArea.x;
+    const int32_t renderMarginBottom = -maxTileImageArea.y;
+
+    // Render each horizontal span of dirty blocks separately. Each span is rendered using the nearby tiles as well
+    // since parts of their objects could be within the span. All images are clipped by the span area.
+    std::vector<fheroes2::Rect> updatedAreas;
+
+    for ( int32_t blockY = 0; blockY < blockCountY; ++blockY ) {
+        for ( int32_t blockX = 0; blockX < blockCountX; ++blockX ) {
+            if ( dirtyBlocks[blockY * blockCountX + blockX] == 0 ) {
+                continue;
+            }
+
+            const int32_t firstBlockX = blockX;
+            while ( blockX < blockCountX && dirtyBlocks[blockY * blockCountX + blockX] != 0 ) {
+                ++blockX;
+            }
+
+            const int32_t spanX = tileROI.x + firstBlockX * partialRenderBlockSize;
+            const int32_t spanY = tileROI.y + blockY * partialRenderBlockSize;
+            const int32_t spanWidth = std::min( ( blockX - firstBlockX ) * partialRenderBlockSize, tileROI.x + tileROI.width - spanX );
+            const int32_t spanHeight = std::min( partialRenderBlockSize, tileROI.y + tileROI.height - spanY );
+
+            const fheroes2::Point spanOffset = GetRelativeTilePosition( { spanX, spanY } );
+            _renderClipROI = _windowROI ^ fheroes2::Rect( spanOffset.x, spanOffset.y, spanWidth * fheroes2::tileWidthPx, spanHeight * fheroes2::tileWidthPx );
+            if ( _renderClipROI.width <= 0 || _renderClipROI.height <= 0 ) {
+                continue;
+            }
+
+            // Tiles outside the visible area are not rendered by the full rendering either. Their tile-unfit objects are still found by the rendering itself.
+            const int32_t minX = std::max( spanX - renderMarginLeft, tileROI.x );
+            const int32_t minY = std::max( spanY - renderMarginTop, tileROI.y );
+            const int32_t maxX = std::min( spanX + spanWidth + renderMarginRight, tileROI.x + tileROI.width );
+            const int32_t maxY = std::min( spanY + spanHeight + renderMarginBottom, tileROI.y + tileROI.height );
+
+            _redraw( dst, flag, false, { minX, minY, maxX - minX, maxY - minY } );
+
+            updatedAreas.emplace_back( _renderClipROI );
+        }
+    }
+
+    _renderClipROI = {};
+
+#ifdef WITH_DEBUG
+    if ( IS_DEBUG( DBG_GAME, DBG_TRACE ) ) {
+        _verifyPartialRendering( dst, flag, tileROI );
+    }
+#endif
+
+    updateObjectAnimationInfo();
+
+    return updatedAreas;
+}
+
+#ifdef WITH_DEBUG
+void Interface::GameArea::_verifyPartialRendering( const fheroes2::Image & dst, const int flag, const fheroes2::Rect & tileROI ) const
+{
+    // Render everything into a separate image without touching the saved rendering state and compare the results.
+    fheroes2::Image fullImage( dst.width(), dst.height() );
+    fullImage._disableTransformLayer();
+
+    _redraw( fullImage, flag, false, tileROI );
+
+    int32_t mismatchCount = 0;
+    fheroes2::Rect mismatchRoi;
+
+    for ( int32_t y = _windowROI.y; y < _windowROI.y + _windowROI.height; ++y ) {
+        const uint8_t * partialY = dst.image() + static_cast<size_t>( y ) * dst.width();
+        const uint8_t * fullY = fullImage.image() + static_cast<size_t>( y ) * fullImage.width();
+
+        for ( int32_t x = _windowROI.x; x < _windowROI.x + _windowROI.width; ++x ) {
+            if ( partialY[x] != fullY[x] ) {
+                ++mismatchCount;
+                mismatchRoi = fheroes2::getBoundaryRect( mismatchRoi, { x, y, 1, 1 } );
+            }
+        }
+    }
+
+    if ( mismatchCount > 0 ) {
+        ERROR_LOG( "Partial rendering of the game area differs from the full rendering in " << mismatchCount << " pixels within the area [" << mismatchRoi.x << ", "
+                                                                                             << mismatchRoi.y << ", " << mismatchRoi.width << ", " << mismatchRoi.height
+                                                                                             << "]." )
+    }
+}
+#endif
+
+void Interface::GameArea::_saveRenderedState( const fheroes2::Image & dst, const int flag, const fheroes2::Rect & tileROI ) const
+{
+    _renderedState.output = &dst;
+    _renderedState.windowROI = _windowROI;
+    _renderedState.topLeftTileOffset = _topLeftTileOffset;
+    _renderedState.tileROI = tileROI;
+    _renderedState.flag = flag;
+    _renderedState.routeSignature = getRouteSignature( ( flag & LEVEL_HEROES ) == LEVEL_HEROES ? GetFocusHeroes() : nullptr );
+
+    const fheroes2::Rect trackedROI = getTrackedTileROI( tileROI );
+    const size_t trackedTileCount = static_cast<size_t>( trackedROI.width ) * trackedROI.height;
+
+    std::vector<uint64_t> & tileSignatures = _renderedState.tileSignatures;
+    tileSignatures.assign( trackedTileCount, 0 );
+
+    std::vector<fheroes2::Rect> & tileImageAreas = _renderedState.tileImageAreas;
+    tileImageAreas.assign( trackedTileCount, { 0, 0, 1, 1 } );
+
+    const int32_t worldWidth = world.w();
+    const int32_t worldHeight = world.h();
+    const bool isEditor = _interface.isEditor();
+
+    const int32_t minTrackedX = std::max( trackedROI.x, 0 );
+    const int32_t maxTrackedX = std::min( trackedROI.x + trackedROI.width, worldWidth );
+
+    for ( int32_t y = std::max( trackedROI.y, 0 ); y < std::min( trackedROI.y + trackedROI.height, worldHeight ); ++y ) {
+        const int32_t trackedOffset = ( y - trackedROI.y ) * trackedROI.width - trackedROI.x;
+
+        for ( int32_t x = minTrackedX; x < maxTrackedX; ++x ) {
+            const Maps::Tile & tile = world.getTile( x, y );
+
+            tileSignatures[trackedOffset + x] = getTileSignature( tile );
+            tileImageAreas[trackedOffset + x] = getTileImageArea( tile, isEditor );
+        }
+    }
+}
+
+void Interface::GameArea::_redraw( fheroes2::Image & dst, const int flag, const bool isPuzzleDraw, const fheroes2::Rect & tileROI ) const
+{
     int32_t maxX = tileROI.x + tileROI.width;
     int32_t maxY = tileROI.y + tileROI.height;
     const int32_t worldWidth = world.w();
@@ -482,10 +932,10 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
 
     // Run through all visible tiles and find all tile-unfit objects.
     // Also cover extra tiles from right and bottom sides because these objects are usually bigger than 1x1 tiles.
-    const int32_t roiToRenderMinX = std::max( minX - 1, 0 );
-    const int32_t roiToRenderMinY = std::max( minY - 1, 0 );
-    const int32_t roiToRenderMaxX = std::min( maxX + 2, worldWidth );
-    const int32_t roiToRenderMaxY = std::min( maxY + 2, worldHeight );
+    const int32_t roiToRenderMinX = std::max( minX - tileUnfitObjectMarginLeftTop, 0 );
+    const int32_t roiToRenderMinY = std::max( minY - tileUnfitObjectMarginLeftTop, 0 );
+    const int32_t roiToRenderMaxX = std::min( maxX + tileUnfitObjectMarginRightBottom, worldWidth );
+    const int32_t roiToRenderMaxY = std::min( maxY + tileUnfitObjectMarginRightBottom, worldHeight );
 
     const bool isEditor = _interface.isEditor();
 
@@ -791,8 +1241,6 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
             }
         }
     }
-
-    updateObjectAnimationInfo();
 }
 
 void Interface::GameArea::renderTileAreaSelect( fheroes2::Image & dst, const int32_t startTile, const int32_t endTile, const bool isActionObject ) const
@@ -198,6 +198,10 @@ namespace Interface
         // Interface::BaseInterface::Redraw() instead to avoid issues in the "no interface" mode
         void Redraw( fheroes2::Image & dst, int flag, bool isPuzzleDraw = false ) const;
 
+        // Re-renders only the tiles which could have changed since the previous rendering: animated objects and tiles with modified content.
+        // The method falls back to the full rendering if the previous rendering state cannot be reused. Returns the updated areas of the image.
+        std::vector<fheroes2::Rect> redrawAnimation( fheroes2::Image & dst, const int flag ) const;
+
         void renderTileAreaSelect( fheroes2::Image & dst, const int32_t startTile, const int32_t endTile, const bool isActionObject ) const;
 
         void BlitOnTile( fheroes2::Image & dst, const fheroes2::Image & src, int32_t ox, int32_t oy, const fheroes2::Point & mp, bool flip, uint8_t alpha ) const;
@@ -267,6 +271,23 @@ namespace Interface
         }
 
     private:
+        // The state of the last full rendering which is used to find tiles that need to be re-rendered.
+        struct RenderedState
+        {
+            const fheroes2::Image * output{ nullptr };
+            fheroes2::Rect windowROI;
+            fheroes2::Point topLeftTileOffset;
+            fheroes2::Rect tileROI;
+            int flag{ 0 };
+            uint64_t routeSignature{ 0 };
+
+            // Signatures of all tracked tiles stored row by row.
+            std::vector<uint64_t> tileSignatures;
+
+            // Areas of tiles covered by the images of the objects of all tracked tiles. Each area is relative to its tile.
+            std::vector<fheroes2::Rect> tileImageAreas;
+        };
+
         BaseInterface & _interface;
 
         fheroes2::Rect _windowROI; // visible to draw area of World Map in pixels
@@ -289,6 +310,10 @@ namespace Interface
         // This member needs to be mutable because it is modified during rendering.
         mutable std::vector<std::shared_ptr<BaseObjectAnimationInfo>> _animationInfo;
 
+        // Partial rendering state. An empty clipping area means that the whole window ROI is used.
+        mutable fheroes2::Rect _renderClipROI;
+        mutable RenderedState _renderedState;
+
         fheroes2::Point _lastMouseDragPosition;
         fheroes2::Point _mousePositionForFastScroll;
         bool _mouseDraggingInitiated{ false };
@@ -308,5 +333,20 @@ namespace Interface
         void _setCenterToTile( const fheroes2::Point & tile ); // set center to the middle of tile (input is tile ID)
 
         void updateObjectAnimationInfo() const;
+
+        // Renders the given tile area. All images are clipped by the current clipping area.
+        void _redraw( fheroes2::Image & dst, const int flag, const bool isPuzzleDraw, const fheroes2::Rect & tileROI ) const;
+
+        void _saveRenderedState( const fheroes2::Image & dst, const int flag, const fheroes2::Rect & tileROI ) const;
+
+#ifdef WITH_DEBUG
+        // Compares the result of the partial rendering with the full rendering of the given tile area and reports the difference.
+        void _verifyPartialRendering( const fheroes2::Image & dst, const int flag, const fheroes2::Rect & tileROI ) const;
+#endif
+
+        const fheroes2::Rect & _getRenderClipROI() const
+        {
+            return _renderClipROI.width > 0 ? _renderClipROI : _windowROI;
+        }
     };
 }
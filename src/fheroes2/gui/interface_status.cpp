@@ -33,6 +33,7 @@
 #include "color.h"
 #include "dialog.h"
 #include "game.h"
+#include "game_benchmark.h"
 #include "game_delays.h"
 #include "game_interface.h"
 #include "heroes.h"
@@ -494,6 +495,10 @@ void Interface::StatusPanel::drawAITurnProgress( const uint32_t progressValue )
     // another music chunk on some platforms (e.g. WebAssembly), etc.
     LocalEvent::Get().HandleEvents( false );
 
+    if ( Benchmark::isHeadlessMode() ) {
+        return;
+    }
+
     const bool updateProgress = ( progressValue != _aiTurnProgress );
     const bool isMapAnimation = Game::validateAnimationDelay( Game::MAPS_DELAY );
 
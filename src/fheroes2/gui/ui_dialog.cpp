@@ -34,6 +34,7 @@
 #include "cursor.h"
 #include "dialog.h"
 #include "experience.h"
+#include "game_benchmark.h"
 #include "game_delays.h"
 #include "game_hotkeys.h"
 #include "heroes_indicator.h"
@@ -94,6 +95,17 @@ namespace fheroes2
     {
         outputInTextSupportMode( header, body, buttons );
 
+        if ( Benchmark::isHeadlessMode() ) {
+            // Nobody is going to answer so the most cautious choice is made.
+            for ( const int button : { Dialog::CANCEL, Dialog::NO, Dialog::OK, Dialog::YES } ) {
+                if ( buttons & button ) {
+                    return button;
+                }
+            }
+
+            return Dialog::ZERO;
+        }
+
         const bool isProperDialog = ( buttons != 0 );
 
         const int cusorTheme = isProperDialog ? ::Cursor::POINTER : ::Cursor::Get().Themes();
@@ -147,6 +147,48 @@ namespace
         }
     }
 
+    // Calls the handler for the index of every map tile which contains a part of the object placed on the given tile.
+    template <typename Handler>
+    void forEachObjectTile( const int32_t mapWidth, const int32_t mainTileIndex, const Maps::Map_Format::TileObjectInfo & object, const Handler & handler )
+    {
+        const Maps::ObjectInfo & objectInfo = Maps::getObjectInfo( object.group, static_cast<int32_t>( object.index ) );
+        const fheroes2::Point mainTilePos{ mainTileIndex % mapWidth, mainTileIndex / mapWidth };
+
+        const auto handlePart = [mapWidth, &mainTilePos, &handler]( const Maps::ObjectPartInfo & partInfo ) {
+            const fheroes2::Point pos = mainTilePos + partInfo.tileOffset;
+
+            // Only square maps are supported so map height is the same as width.
+            if ( pos.x >= 0 && pos.y >= 0 && pos.x < mapWidth && pos.y < mapWidth ) {
+                handler( pos.y * mapWidth + pos.x );
+            }
+        };
+
+        for ( const auto & partInfo : objectInfo.groundLevelParts ) {
+            handlePart( partInfo );
+        }
+
+        for ( const auto & partInfo : objectInfo.topLevelParts ) {
+            handlePart( partInfo );
+        }
+    }
+
+    // Towns, heroes and objects with an owner are set by updatePlayerRelatedObjects() which works only for the whole map.
+    bool isPlayerRelatedObject( const Maps::Map_Format::MapFormat & map, const Maps::Map_Format::TileObjectInfo & object )
+    {
+        switch ( object.group ) {
+        case Maps::ObjectGroup::KINGDOM_HEROES:
+        case Maps::ObjectGroup::KINGDOM_TOWNS:
+        case Maps::ObjectGroup::LANDSCAPE_FLAGS:
+        case Maps::ObjectGroup::LANDSCAPE_TOWN_BASEMENTS:
+            return true;
+        default:
+            break;
+        }
+
+        return map.capturableObjectsMetadata.find( object.id ) != map.capturableObjectsMetadata.end()
+               && Maps::isCapturableObject( Maps::getObjectInfo( object.group, static_cast<int32_t>( object.index ) ).objectType );
+    }
+
     // This function only checks for Streams and ignores River Deltas.
     bool isStreamPresent( const Maps::Map_Format::TileInfo & mapTile )
     {
@@ -1189,13 +1231,103 @@ namespace Maps
             return false;
         }
 
+        updatePlayerRelatedObjects( map );
+
+        // Ownership flags affect passabilities of tiles around them so passabilities must be updated after setting objects owners.
+        // Otherwise, passabilities would depend on whether tiles are read all at once or not.
         world.updatePassabilities();
 
-        updatePlayerRelatedObjects( map );
+        return true;
+    }
+
+    bool readMapTilesInEditor( const Map_Format::MapFormat & map, std::set<int32_t> tileIndices )
+    {
+        assert( map.width == world.w() && map.width == world.h() );
+
+        if ( tileIndices.empty() ) {
+            return true;
+        }
+
+        // Reading of a big part of the map is not faster than reading the whole map.
+        const size_t maxTilesCount = map.tiles.size() / 4;
+
+        // Objects may overlap each other so all objects located on the given tiles must be placed again in the order of their UIDs.
+        // As a result, all tiles of these objects must be read as well which may add more objects. Repeat it until no tiles are added.
+        std::vector<IndexedObjectInfo> objects;
+        size_t tilesCount = 0;
+
+        while ( tilesCount != tileIndices.size() ) {
+            tilesCount = tileIndices.size();
+            if ( tilesCount > maxTilesCount ) {
+                return false;
+            }
+
+            objects.clear();
+
+            for ( size_t i = 0; i < map.tiles.size(); ++i ) {
+                const int32_t tileIndex = static_cast<int32_t>( i );
+
+                for ( const auto & object : map.tiles[i].objects ) {
+                    bool isObjectOnTiles = false;
+                    forEachObjectTile( map.width, tileIndex, object, [&tileIndices, &isObjectOnTiles]( const int32_t index ) {
+                        isObjectOnTiles = isObjectOnTiles || ( tileIndices.find( index ) != tileIndices.end() );
+                    } );
+
+                    if ( !isObjectOnTiles ) {
+                        continue;
+                    }
+
+                    if ( isPlayerRelatedObject( map, object ) ) {
+                        return false;
+                    }
+
+                    objects.push_back( { tileIndex, &object } );
+                }
+            }
+
+            for ( const IndexedObjectInfo & info : objects ) {
+                forEachObjectTile( map.width, info.tileIndex, *info.info, [&tileIndices]( const int32_t index ) { tileIndices.emplace( index ); } );
+            }
+        }
+
+        // Keep the same order of objects with equal UIDs as while reading all tiles.
+        std::stable_sort( objects.begin(), objects.end(),
+                          []( const IndexedObjectInfo & left, const IndexedObjectInfo & right ) { return left.info->id < right.info->id; } );
+
+        for ( const int32_t tileIndex : tileIndices ) {
+            Maps::Tile & worldTile = world.getTile( tileIndex );
+
+            // Reset the object type first to keep the world object type index up to date.
+            worldTile.setMainObjectType( MP2::OBJ_NONE );
+
+            worldTile = {};
+            worldTile.setIndex( tileIndex );
+            worldTile.setTerrain( map.tiles[tileIndex].terrainIndex, map.tiles[tileIndex].terrainFlags );
+        }
+
+        // Reading of objects changes the object UID counter.
+        const uint32_t lastObjectUID = getLastObjectUID();
+
+        for ( const IndexedObjectInfo & info : objects ) {
+            if ( !readTileObject( world.getTile( info.tileIndex ), *info.info ) ) {
+                return false;
+            }
+        }
+
+        setLastObjectUID( lastObjectUID );
+
+        world.updatePassabilities( tileIndices );
 
         return true;
     }
 
+    void addObjectsTileIndices( const Map_Format::MapFormat & map, const int32_t tileIndex, const Map_Format::TileInfo & tile, std::set<int32_t> & tileIndices )
+    {
+        for ( const auto & object : tile.objects ) {
+            forEachObjectTile( map.width, tileIndex, object, [&tileIndices]( const int32_t index ) { tileIndices.emplace( index ); } );
+        }
+    }
+
     bool readAllTiles( const Map_Format::MapFormat & map )
     {
         assert( map.width == world.w() && map.width == world.h() );
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <set>
 #include <vector>
 
 class Army;
@@ -47,8 +48,17 @@ namespace Maps
     enum class ObjectGroup : uint8_t;
 
     bool readMapInEditor( const Map_Format::MapFormat & map );
+
+    // Reads only the given tiles of the map and the tiles of objects located on them into the world. The given tiles must include
+    // all tiles of objects added or removed since the last reading. Towns, heroes and object owners can only be updated by reading
+    // the whole map. Returns false when the whole map must be read. The world is not modified in this case unless the map is broken.
+    bool readMapTilesInEditor( const Map_Format::MapFormat & map, std::set<int32_t> tileIndices );
+
     bool readAllTiles( const Map_Format::MapFormat & map );
 
+    // Adds indices of all tiles containing parts of the objects placed on the given map tile.
+    void addObjectsTileIndices( const Map_Format::MapFormat & map, const int32_t tileIndex, const Map_Format::TileInfo & tile, std::set<int32_t> & tileIndices );
+
     bool readTileObject( Tile & tile, const Map_Format::TileObjectInfo & object );
 
     void setTerrainOnTiles( Map_Format::MapFormat & map, const int32_t startTileId, const int32_t endTileId, const int groundId );
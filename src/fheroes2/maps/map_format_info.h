@@ -42,6 +42,16 @@ namespace Maps::Map_Format
         ObjectGroup group{ ObjectGroup::NONE };
 
         uint32_t index{ 0 };
+
+        bool operator==( const TileObjectInfo & anotherObject ) const
+        {
+            return id == anotherObject.id && group == anotherObject.group && index == anotherObject.index;
+        }
+
+        bool operator!=( const TileObjectInfo & anotherObject ) const
+        {
+            return !( *this == anotherObject );
+        }
     };
 
     struct TileInfo
@@ -50,6 +60,16 @@ namespace Maps::Map_Format
         uint8_t terrainFlags{ 0 };
 
         std::vector<TileObjectInfo> objects;
+
+        bool operator==( const TileInfo & anotherTile ) const
+        {
+            return terrainIndex == anotherTile.terrainIndex && terrainFlags == anotherTile.terrainFlags && objects == anotherTile.objects;
+        }
+
+        bool operator!=( const TileInfo & anotherTile ) const
+        {
+            return !( *this == anotherTile );
+        }
     };
 
     struct CastleMetadata
@@ -195,6 +215,16 @@ namespace Maps::Map_Format
     struct SignMetadata
     {
         std::string message;
+
+        bool operator==( const SignMetadata & anotherMetadata ) const
+        {
+            return message == anotherMetadata.message;
+        }
+
+        bool operator!=( const SignMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct AdventureMapEventMetadata
@@ -249,11 +279,31 @@ namespace Maps::Map_Format
     struct SelectionObjectMetadata
     {
         std::vector<int32_t> selectedItems;
+
+        bool operator==( const SelectionObjectMetadata & anotherMetadata ) const
+        {
+            return selectedItems == anotherMetadata.selectedItems;
+        }
+
+        bool operator!=( const SelectionObjectMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct CapturableObjectMetadata
     {
         PlayerColor ownerColor{ 0 };
+
+        bool operator==( const CapturableObjectMetadata & anotherMetadata ) const
+        {
+            return ownerColor == anotherMetadata.ownerColor;
+        }
+
+        bool operator!=( const CapturableObjectMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct MonsterMetadata
@@ -268,6 +318,17 @@ namespace Maps::Map_Format
 
         // Only for random monsters.
         std::vector<int> selected;
+
+        bool operator==( const MonsterMetadata & anotherMetadata ) const
+        {
+            return count == anotherMetadata.count && joinCondition == anotherMetadata.joinCondition
+                   && isWeeklyGrowthDisabled == anotherMetadata.isWeeklyGrowthDisabled && selected == anotherMetadata.selected;
+        }
+
+        bool operator!=( const MonsterMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct ArtifactMetadata
@@ -280,11 +341,31 @@ namespace Maps::Map_Format
 
         // Only for random artifacts and Scroll Spell.
         std::vector<int> selected;
+
+        bool operator==( const ArtifactMetadata & anotherMetadata ) const
+        {
+            return radius == anotherMetadata.radius && captureCondition == anotherMetadata.captureCondition && selected == anotherMetadata.selected;
+        }
+
+        bool operator!=( const ArtifactMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct ResourceMetadata
     {
         int32_t count{ 0 };
+
+        bool operator==( const ResourceMetadata & anotherMetadata ) const
+        {
+            return count == anotherMetadata.count;
+        }
+
+        bool operator!=( const ResourceMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct DailyEvent
@@ -302,6 +383,18 @@ namespace Maps::Map_Format
 
         // Resources to be given as a reward.
         Funds resources;
+
+        bool operator==( const DailyEvent & anotherEvent ) const
+        {
+            return message == anotherEvent.message && humanPlayerColors == anotherEvent.humanPlayerColors
+                   && computerPlayerColors == anotherEvent.computerPlayerColors && firstOccurrenceDay == anotherEvent.firstOccurrenceDay
+                   && repeatPeriodInDays == anotherEvent.repeatPeriodInDays && resources == anotherEvent.resources;
+        }
+
+        bool operator!=( const DailyEvent & anotherEvent ) const
+        {
+            return !( *this == anotherEvent );
+        }
     };
 
     struct BaseMapFormat
@@ -343,6 +436,23 @@ namespace Maps::Map_Format
         // This parameter is only visible within the Editor, it doesn't affect the gameplay in any way.
         // The parameter is mandatory to fill out by map makers who want to have their creations bundled with the engine.
         std::string creatorNotes;
+
+        bool operator==( const BaseMapFormat & anotherMap ) const
+        {
+            return version == anotherMap.version && isCampaign == anotherMap.isCampaign && difficulty == anotherMap.difficulty
+                   && availablePlayerColors == anotherMap.availablePlayerColors && humanPlayerColors == anotherMap.humanPlayerColors
+                   && computerPlayerColors == anotherMap.computerPlayerColors && alliances == anotherMap.alliances && playerRace == anotherMap.playerRace
+                   && victoryConditionType == anotherMap.victoryConditionType
+                   && isVictoryConditionApplicableForAI == anotherMap.isVictoryConditionApplicableForAI && allowNormalVictory == anotherMap.allowNormalVictory
+                   && victoryConditionMetadata == anotherMap.victoryConditionMetadata && lossConditionType == anotherMap.lossConditionType
+                   && lossConditionMetadata == anotherMap.lossConditionMetadata && width == anotherMap.width && mainLanguage == anotherMap.mainLanguage
+                   && name == anotherMap.name && description == anotherMap.description && creatorNotes == anotherMap.creatorNotes;
+        }
+
+        bool operator!=( const BaseMapFormat & anotherMap ) const
+        {
+            return !( *this == anotherMap );
+        }
     };
 
     struct MapFormat : public BaseMapFormat
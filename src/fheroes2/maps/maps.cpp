@@ -27,6 +27,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <iterator>
 #include <ostream>
 
 #include "ai_planner.h"
@@ -43,6 +44,8 @@
 #include "resource.h"
 #include "translations.h"
 #include "world.h"
+#include "world_fog.h"
+#include "world_object_index.h"
 
 namespace
 {
@@ -59,13 +62,29 @@ namespace
 
     Maps::Indexes MapsIndexesObject( const MP2::MapObjectType objectType, const bool ignoreHeroes )
     {
-        Maps::Indexes result;
-        const int32_t size = static_cast<int32_t>( world.getSize() );
-        for ( int32_t idx = 0; idx < size; ++idx ) {
-            if ( world.getTile( idx ).getMainObjectType( !ignoreHeroes ) == objectType ) {
-                result.push_back( idx );
+        const Maps::ObjectTypeIndex & objectTypeIndex = world.getObjectTypeIndex();
+        if ( !objectTypeIndex.isValid() || objectType == MP2::OBJ_NONE ) {
+            Maps::Indexes result;
+            const int32_t size = static_cast<int32_t>( world.getSize() );
+            for ( int32_t idx = 0; idx < size; ++idx ) {
+                if ( world.getTile( idx ).getMainObjectType( !ignoreHeroes ) == objectType ) {
+                    result.push_back( idx );
+                }
             }
+            return result;
+        }
+
+        const Maps::Indexes & objectIndexes = objectTypeIndex.getTileIndexes( objectType );
+        if ( !ignoreHeroes || objectType == MP2::OBJ_HERO ) {
+            return ignoreHeroes ? MapsIndexesFilteredObject( objectIndexes, objectType ) : objectIndexes;
         }
+
+        // The object might also be hidden under a hero.
+        const Maps::Indexes objectsUnderHeroes = MapsIndexesFilteredObject( objectTypeIndex.getTileIndexes( MP2::OBJ_HERO ), objectType );
+
+        Maps::Indexes result;
+        result.reserve( objectIndexes.size() + objectsUnderHeroes.size() );
+        std::merge( objectIndexes.begin(), objectIndexes.end(), objectsUnderHeroes.begin(), objectsUnderHeroes.end(), std::back_inserter( result ) );
         return result;
     }
 
@@ -91,6 +110,20 @@ namespace
 
         return squaredDistanceLimit;
     }
+
+    // Returns the maximum horizontal distance from the center of the scouting area to tiles of the row located at 'dy' distance from the center
+    // or -1 if the row is not within the scouting area. Tiles within the scouting area of each row form a single continuous span.
+    int32_t getScoutingRowHalfWidth( const int32_t scoutingDistance, const int32_t squaredScoutingRadiusLimit, const int32_t dy )
+    {
+        const int32_t dySquared = dy * dy;
+
+        int32_t halfWidth = scoutingDistance;
+        while ( halfWidth >= 0 && halfWidth * halfWidth + dySquared >= squaredScoutingRadiusLimit ) {
+            --halfWidth;
+        }
+
+        return halfWidth;
+    }
 }
 
 struct ComparisonDistance
@@ -401,33 +434,38 @@ void Maps::ClearFog( const int32_t tileIndex, const int32_t scoutingDistance, co
     fheroes2::Point fogRevealMinPos( world.h(), worldWidth );
     fheroes2::Point fogRevealMaxPos( 0, 0 );
 
+    const FogLayers & fogLayers = world.getFogLayers();
+
     for ( int32_t y = minY; y <= maxY; ++y ) {
-        const int32_t dy = y - center.y;
-        const int32_t dySquared = dy * dy;
+        const int32_t halfWidth = getScoutingRowHalfWidth( scoutingDistance, squaredScoutingRadiusLimit, y - center.y );
+        if ( halfWidth < 0 ) {
+            continue;
+        }
+
+        const int32_t rowMinX = std::max( center.x - halfWidth, minX );
+        const int32_t rowMaxX = std::min( center.x + halfWidth, maxX );
         const int32_t offset = y * worldWidth;
 
-        for ( int32_t x = minX; x <= maxX; ++x ) {
-            const int32_t dx = x - center.x;
-            if ( dx * dx + dySquared < squaredScoutingRadiusLimit ) {
-                Maps::Tile & tile = world.getTile( x + offset );
-                if ( isAIPlayer && tile.isFog( playerColor ) ) {
-                    AI::Planner::Get().revealFog( tile, kingdom );
-                }
+        // Only tiles under the fog are visited here, the rest of the tiles within the scouting area are skipped by whole words.
+        fogLayers.forEachFogTileInRow( playerColor, alliedColors, y, rowMinX, rowMaxX, [&]( const int32_t x, const bool isPlayerFog, const bool isAlliedFog ) {
+            Maps::Tile & tile = world.getTile( x + offset );
+            if ( isAIPlayer && isPlayerFog ) {
+                AI::Planner::Get().revealFog( tile, kingdom );
+            }
+
+            if ( isAlliedFog ) {
+                // Clear fog only if it is not already cleared.
+                tile.ClearFog( alliedColors );
 
-                if ( tile.isFog( alliedColors ) ) {
-                    // Clear fog only if it is not already cleared.
-                    tile.ClearFog( alliedColors );
-
-                    if ( isHumanOrHumanFriend ) {
-                        // Update fog reveal area points only for human player and his allies.
-                        fogRevealMinPos.x = std::min( fogRevealMinPos.x, x );
-                        fogRevealMinPos.y = std::min( fogRevealMinPos.y, y );
-                        fogRevealMaxPos.x = std::max( fogRevealMaxPos.x, x );
-                        fogRevealMaxPos.y = std::max( fogRevealMaxPos.y, y );
-                    }
+                if ( isHumanOrHumanFriend ) {
+                    // Update fog reveal area points only for human player and his allies.
+                    fogRevealMinPos.x = std::min( fogRevealMinPos.x, x );
+                    fogRevealMinPos.y = std::min( fogRevealMinPos.y, y );
+                    fogRevealMaxPos.x = std::max( fogRevealMaxPos.x, x );
+                    fogRevealMaxPos.y = std::max( fogRevealMaxPos.y, y );
                 }
             }
-        }
+        } );
     }
 
     // Update fog directions only for human player and his allies and only if fog has to be cleared.
@@ -459,19 +497,12 @@ int32_t Maps::getFogTileCountToBeRevealed( const int32_t tileIndex, const int32_
 
     int32_t tileCount = 0;
 
-    for ( int32_t y = minY; y <= maxY; ++y ) {
-        const int32_t dy = y - center.y;
-        const int32_t dySquared = dy * dy;
-        const int32_t offset = y * worldWidth;
+    const FogLayers & fogLayers = world.getFogLayers();
 
-        for ( int32_t x = minX; x <= maxX; ++x ) {
-            const int32_t dx = x - center.x;
-            if ( dx * dx + dySquared < squaredScoutingRadiusLimit ) {
-                const Maps::Tile & tile = world.getTile( x + offset );
-                if ( tile.isFog( playerColor ) ) {
-                    ++tileCount;
-                }
-            }
+    for ( int32_t y = minY; y <= maxY; ++y ) {
+        const int32_t halfWidth = getScoutingRowHalfWidth( scoutingDistance, squaredScoutingRadiusLimit, y - center.y );
+        if ( halfWidth >= 0 ) {
+            tileCount += fogLayers.countFogTilesInRow( playerColor, y, std::max( center.x - halfWidth, minX ), std::min( center.x + halfWidth, maxX ) );
         }
     }
 
@@ -498,13 +529,50 @@ Maps::Indexes Maps::ScanAroundObject( const int32_t center, const MP2::MapObject
 
 Maps::Indexes Maps::ScanAroundObjectWithDistance( const int32_t center, const uint32_t dist, const MP2::MapObjectType objectType )
 {
-    Indexes results = getAroundIndexes( center, dist );
-    std::sort( results.begin(), results.end(), ComparisonDistance( center ) );
-    return MapsIndexesFilteredObject( results, objectType );
+    const ObjectTypeIndex & objectTypeIndex = world.getObjectTypeIndex();
+    if ( !objectTypeIndex.isValid() || objectType == MP2::OBJ_NONE || !isValidAbsIndex( center ) ) {
+        Indexes results = getAroundIndexes( center, dist );
+        std::sort( results.begin(), results.end(), ComparisonDistance( center ) );
+        return MapsIndexesFilteredObject( results, objectType );
+    }
+
+    if ( dist < 1 ) {
+        return {};
+    }
+
+    const int32_t distance = static_cast<int32_t>( dist );
+    const fheroes2::Point centerPoint = GetPoint( center );
+
+    fheroes2::Rect area;
+    area.x = std::max( centerPoint.x - distance, 0 );
+    area.y = std::max( centerPoint.y - distance, 0 );
+    area.width = std::min( centerPoint.x + distance + 1, world.w() ) - area.x;
+    area.height = std::min( centerPoint.y + distance + 1, world.h() ) - area.y;
+
+    // Only tiles with the object itself or with a hero (which might stand on this object) have to be checked.
+    Indexes results;
+    objectTypeIndex.getTileIndexes( objectType, area, world.w(), results );
+    if ( objectType != MP2::OBJ_HERO ) {
+        objectTypeIndex.getTileIndexes( MP2::OBJ_HERO, area, world.w(), results );
+    }
+
+    // The center tile is never included in the result.
+    results.erase( std::remove( results.begin(), results.end(), center ), results.end() );
+
+    results = MapsIndexesFilteredObject( results, objectType );
+
+    // The tiles from the area are sorted by their indexes so tiles at the same distance are always returned in the same order.
+    std::stable_sort( results.begin(), results.end(), ComparisonDistance( center ) );
+    return results;
 }
 
 bool Maps::doesObjectExistOnMap( const MP2::MapObjectType objectType )
 {
+    const ObjectTypeIndex & objectTypeIndex = world.getObjectTypeIndex();
+    if ( objectTypeIndex.isValid() && objectType != MP2::OBJ_NONE ) {
+        return !MapsIndexesObject( objectType, true ).empty();
+    }
+
     const int32_t size = static_cast<int32_t>( world.getSize() );
     for ( int32_t idx = 0; idx < size; ++idx ) {
         if ( world.getTile( idx ).getMainObjectType( false ) == objectType ) {
@@ -25,13 +25,18 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <list>
 #include <map>
+#include <set>
 #include <sstream>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "color.h"
 #include "difficulty.h"
@@ -49,6 +54,7 @@
 #include "serialize.h"
 #include "settings.h"
 #include "system.h"
+#include "thread.h"
 #include "tools.h"
 #include "ui_font.h"
 #include "ui_language.h"
@@ -58,6 +64,246 @@ namespace
     const size_t mapNameLength = 16;
     const size_t mapDescriptionLength = 200;
 
+    const uint16_t mapCatalogueMagicNumber{ 0xFF05 };
+
+    // Should be increased whenever the map file parsing logic changes in a way that affects the cached information
+    const uint16_t mapCatalogueVersion{ 1 };
+
+    // Information about the map file stored in the map catalogue
+    struct MapCatalogueEntry final
+    {
+        uint64_t fileSize{ 0 };
+        int64_t modificationTime{ 0 };
+
+        // Whether this file is a valid map file. Maps without human players are considered valid here, because they can still be
+        // opened in the Editor.
+        bool isValid{ false };
+
+        Maps::FileInfo fileInfo;
+    };
+
+    OStreamBase & operator<<( OStreamBase & stream, const MapCatalogueEntry & entry )
+    {
+        const uint64_t modificationTime = static_cast<uint64_t>( entry.modificationTime );
+
+        stream.put32( static_cast<uint32_t>( entry.fileSize >> 32 ) );
+        stream.put32( static_cast<uint32_t>( entry.fileSize & 0xFFFFFFFF ) );
+        stream.put32( static_cast<uint32_t>( modificationTime >> 32 ) );
+        stream.put32( static_cast<uint32_t>( modificationTime & 0xFFFFFFFF ) );
+
+        return stream << entry.isValid << entry.fileInfo;
+    }
+
+    IStreamBase & operator>>( IStreamBase & stream, MapCatalogueEntry & entry )
+    {
+        entry.fileSize = static_cast<uint64_t>( stream.get32() ) << 32;
+        entry.fileSize |= stream.get32();
+
+        uint64_t modificationTime = static_cast<uint64_t>( stream.get32() ) << 32;
+        modificationTime |= stream.get32();
+
+        entry.modificationTime = static_cast<int64_t>( modificationTime );
+
+        return stream >> entry.isValid >> entry.fileInfo;
+    }
+
+    // Persistent cache of parsed map file headers, the key is the full path to the map file. The catalogue is loaded from disk
+    // once, then it is kept in memory and only new or modified map files are parsed.
+    class MapCatalogue
+    {
+    public:
+        // Returns the entries for the given map files in the same order. If a file cannot be accessed, then nullptr is returned
+        // for it. Returned pointers remain valid until the next call of this method.
+        std::vector<const MapCatalogueEntry *> getEntries( const ListFiles & mapFiles, const bool isOriginalMapFormat )
+        {
+            if ( !_isLoaded ) {
+                load();
+
+                _isLoaded = true;
+            }
+
+            std::vector<const MapCatalogueEntry *> result;
+            result.reserve( mapFiles.size() );
+
+            std::vector<std::pair<const std::string *, MapCatalogueEntry *>> outdatedEntries;
+            std::set<std::string_view> existingMapFiles;
+
+            for ( const std::string & mapFile : mapFiles ) {
+                uint64_t fileSize = 0;
+                int64_t modificationTime = 0;
+
+                if ( !System::GetFileStatus( mapFile, fileSize, modificationTime ) ) {
+                    result.push_back( nullptr );
+                    continue;
+                }
+
+                existingMapFiles.insert( mapFile );
+
+                MapCatalogueEntry & entry = _entries[mapFile];
+
+                result.push_back( &entry );
+
+                if ( entry.fileSize == fileSize && entry.modificationTime == modificationTime ) {
+                    continue;
+                }
+
+                entry.fileSize = fileSize;
+                entry.modificationTime = modificationTime;
+
+                outdatedEntries.emplace_back( &mapFile, &entry );
+            }
+
+            // The given list contains all the existing map files of this format, so the entries for the other files of this format
+            // belong to the map files which no longer exist
+            bool areEntriesRemoved = false;
+
+            for ( auto iter = _entries.begin(); iter != _entries.end(); ) {
+                if ( isOriginalMapFormatFile( iter->first ) == isOriginalMapFormat && existingMapFiles.count( iter->first ) == 0 ) {
+                    iter = _entries.erase( iter );
+                    areEntriesRemoved = true;
+                }
+                else {
+                    ++iter;
+                }
+            }
+
+            if ( outdatedEntries.empty() ) {
+                if ( areEntriesRemoved ) {
+                    save();
+                }
+
+                return result;
+            }
+
+            // Map files are parsed in the "for Editor" mode, so that maps without human players are cached as well
+            MultiThreading::parallelFor( outdatedEntries.size(), [&outdatedEntries, isOriginalMapFormat]( const size_t idx ) {
+                const auto & [mapFile, entry] = outdatedEntries[idx];
+
+                if ( isOriginalMapFormat ) {
+                    entry->isValid = entry->fileInfo.readMP2Map( *mapFile, true );
+                }
+                else {
+                    entry->isValid = entry->fileInfo.readResurrectionMap( *mapFile, true );
+                }
+            } );
+
+            save();
+
+            return result;
+        }
+
+    private:
+        std::map<std::string, MapCatalogueEntry> _entries;
+
+        bool _isLoaded{ false };
+
+        // The catalogue is a cache that is written by the game itself, so it is kept in the config directory which is always writable
+        // unlike the data directory
+        static std::string getCatalogueDirectory()
+        {
+            return System::GetConfigDirectory( "fheroes2" );
+        }
+
+        static std::string getCatalogueFilePath()
+        {
+            return System::concatPath( getCatalogueDirectory(), "maps.idx" );
+        }
+
+        void load()
+        {
+            const std::string filePath = getCatalogueFilePath();
+
+            StreamFile fileStream;
+            fileStream.setBigendian( true );
+
+            if ( !fileStream.open( filePath, "rb" ) ) {
+                return;
+            }
+
+            uint16_t magicNumber = 0;
+            uint16_t saveFormatVersion = 0;
+            uint16_t catalogueVersion = 0;
+
+            fileStream >> magicNumber >> saveFormatVersion >> catalogueVersion;
+
+            // The catalogue is always rebuilt from scratch if it was written by a different version of the game
+            if ( fileStream.fail() || magicNumber != mapCatalogueMagicNumber || saveFormatVersion != CURRENT_FORMAT_VERSION
+                 || catalogueVersion != mapCatalogueVersion ) {
+                return;
+            }
+
+            // Map file information is stored in the save file format
+            Game::SetVersionOfCurrentSaveFile( CURRENT_FORMAT_VERSION );
+
+            fileStream >> _entries;
+
+            if ( fileStream.fail() ) {
+                DEBUG_LOG( DBG_GAME, DBG_WARN, "Error reading the map catalogue " << filePath )
+
+                _entries.clear();
+            }
+        }
+
+        void save() const
+        {
+            const std::string catalogueDirectory = getCatalogueDirectory();
+
+            if ( !System::IsDirectory( catalogueDirectory ) && !System::MakeDirectory( catalogueDirectory ) ) {
+                DEBUG_LOG( DBG_GAME, DBG_WARN, "Unable to create the directory " << catalogueDirectory )
+                return;
+            }
+
+            const std::string filePath = getCatalogueFilePath();
+
+            // The catalogue is written to a temporary file first, which then replaces the existing catalogue
+            const std::string tempFilePath = filePath + ".tmp";
+
+            StreamFile fileStream;
+            fileStream.setBigendian( true );
+
+            if ( !fileStream.open( tempFilePath, "wb" ) ) {
+                DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << tempFilePath )
+                return;
+            }
+
+            fileStream << mapCatalogueMagicNumber << CURRENT_FORMAT_VERSION << mapCatalogueVersion << _entries;
+
+            const bool isWritten = !fileStream.fail() && fileStream.sync();
+
+            // The file must be closed before it is renamed or removed
+            if ( !fileStream.close() || !isWritten ) {
+                DEBUG_LOG( DBG_GAME, DBG_WARN, "Error writing the map catalogue " << tempFilePath )
+
+                System::Unlink( tempFilePath );
+                StreamFile::syncFileSystem();
+                return;
+            }
+
+            if ( !System::Rename( tempFilePath, filePath ) ) {
+                DEBUG_LOG( DBG_GAME, DBG_WARN, "Error renaming the file " << tempFilePath << " to " << filePath )
+
+                System::Unlink( tempFilePath );
+            }
+
+            // The file system was synchronized when the file was closed, so the renaming must be synchronized separately
+            StreamFile::syncFileSystem();
+        }
+
+        // Returns true if the given map file has the original (MP2 or MX2) format, otherwise it is a Resurrection map file
+        static bool isOriginalMapFormatFile( const std::string & mapFile )
+        {
+            const std::string_view resurrectionMapExtension{ ".fh2m" };
+
+            if ( mapFile.size() < resurrectionMapExtension.size() ) {
+                return true;
+            }
+
+            return StringLower( mapFile.substr( mapFile.size() - resurrectionMapExtension.size() ) ) != resurrectionMapExtension;
+        }
+    };
+
+    MapCatalogue mapCatalogue;
+
     // This function returns an unsorted array. It is a caller responsibility to take care of sorting if needed.
     MapsFileInfoList getValidMaps( const ListFiles & mapFiles, const uint8_t humanPlayerCount, const bool isForEditor, const bool isOriginalMapFormat )
     {
@@ -72,20 +318,28 @@ namespace
             = isOriginalMapFormat
               && ( fheroes2::getCurrentLanguage() == fheroes2::SupportedLanguage::French && fheroes2::getResourceLanguage() == fheroes2::SupportedLanguage::French );
 
-        for ( const std::string & mapFile : mapFiles ) {
-            Maps::FileInfo fi;
+        const std::vector<const MapCatalogueEntry *> entries = mapCatalogue.getEntries( mapFiles, isOriginalMapFormat );
+        assert( entries.size() == mapFiles.size() );
 
-            if ( isOriginalMapFormat ) {
-                if ( !fi.readMP2Map( mapFile, isForEditor ) ) {
-                    continue;
-                }
+        auto entryIter = entries.begin();
+
+        for ( const std::string & mapFile : mapFiles ) {
+            const MapCatalogueEntry * entry = *( entryIter++ );
+            if ( entry == nullptr || !entry->isValid ) {
+                continue;
             }
-            else {
-                if ( !fi.readResurrectionMap( mapFile, isForEditor ) ) {
-                    continue;
-                }
+
+            if ( !isForEditor && entry->fileInfo.colorsAvailableForHumans == 0 ) {
+                // This is not a valid map since no human players exist so it cannot be played.
+                DEBUG_LOG( DBG_GAME, DBG_WARN, "Map " << mapFile << " does not contain any human players." )
+                continue;
             }
 
+            Maps::FileInfo fi = entry->fileInfo;
+
+            // Catalogue entries are keyed by the full path of the map file, but the serialized map info only keeps the file name, so restore the full path
+            fi.filename = mapFile;
+
             if ( !isForEditor ) {
                 assert( humanPlayerCount >= 1 );
 
@@ -415,7 +415,9 @@ void Maps::Tile::Init( const MP2::MP2TileInfo & mp2 )
 {
     _metadata[0] = ( ( ( mp2.quantity2 << 8 ) + mp2.quantity1 ) >> 3 );
 
-    setMainObjectType( static_cast<MP2::MapObjectType>( mp2.mapObjectType ) );
+    // This method is also used to parse map headers outside of the world (possibly in multiple threads at once), so the world state
+    // should not be touched here. All the world caches are reset after the whole map is loaded anyway.
+    _mainObjectType = static_cast<MP2::MapObjectType>( mp2.mapObjectType );
 
     if ( !MP2::doesObjectContainMetadata( _mainObjectType ) && ( _metadata[0] != 0 ) ) {
         // No metadata should exist for non-action objects.
@@ -498,8 +500,10 @@ MP2::MapObjectType Maps::Tile::_getMainObjectTypeUnderHero() const
 
 void Maps::Tile::setMainObjectType( const MP2::MapObjectType objectType )
 {
+    const MP2::MapObjectType oldObjectType = _mainObjectType;
     _mainObjectType = objectType;
 
+    world.updateObjectTypeIndex( _index, oldObjectType, objectType );
     world.resetPathfinder();
 }
 
@@ -1571,6 +1575,8 @@ void Maps::Tile::ClearFog( const PlayerColorsSet colors )
 {
     _fogColors &= ~colors;
 
+    world.updateFogLayers( _index, colors );
+
     // The fog might be cleared even without the hero's movement - for example, the hero can gain a new level of Scouting
     // skill by picking up a Treasure Chest from a nearby tile or buying a map in a Magellan's Maps object using the space
     // bar button. Reset the pathfinder(s) to make the newly discovered tiles immediately available for this hero.
@@ -54,6 +54,7 @@
 #include "tools.h"
 #include "week.h"
 #include "world.h"
+#include "world_fog.h"
 #include "world_object_uid.h"
 
 namespace
@@ -2123,13 +2124,12 @@ namespace Maps
 
         // Cache the 'fogData' data for the given area to use it in fog direction calculation.
         // The loops run only within the world area, if 'fogData' area includes tiles outside the world borders we do not update them as the are already set to 1.
+        const FogLayers & fogLayers = world.getFogLayers();
+
         for ( int32_t y = fogMinY; y < fogMaxY; ++y ) {
-            const int32_t fogTileOffsetY = y * worldWidth;
             const int32_t fogDataOffsetY = y * fogDataWidth + fogDataOffset;
 
-            for ( int32_t x = fogMinX; x < fogMaxX; ++x ) {
-                fogData[x + fogDataOffsetY] = world.getTile( x + fogTileOffsetY ).isFog( colors ) ? 1 : 0;
-            }
+            fogLayers.getFogRow( colors, y, fogMinX, fogMaxX - 1, &fogData[fogMinX + fogDataOffsetY] );
         }
 
         // Set the 'fogData' index offset from the tile index for the TOP LEFT direction from the tile.
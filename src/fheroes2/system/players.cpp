@@ -381,6 +381,9 @@ void Players::SetPlayerControl( const PlayerColor color, const int control )
 
     if ( player ) {
         player->SetControl( control );
+
+        // The set of human players might have been changed
+        humanColors = 0;
     }
 }
 
@@ -390,14 +390,15 @@ public:
     static bool findFile( const std::string & internalDirectory, const std::string & fileName, std::string & fullPath );
     static std::string GetLastFile( const std::string & prefix, const std::string & name );
 
+    // Sets the logging level from the value of the "debug" option of the configuration file.
+    static void setDebug( int debug );
+
 private:
     friend OStreamBase & operator<<( OStreamBase & stream, const Settings & conf );
     friend IStreamBase & operator>>( IStreamBase & stream, Settings & conf );
 
     Settings();
 
-    static void setDebug( int debug );
-
     // Game related options.
     BitModes _gameOptions;
 
@@ -307,6 +307,8 @@ void World::Reset()
 
     // maps tiles
     vec_tiles.clear();
+    _objectTypeIndex.invalidate();
+    _fogLayers.reset( 0, 0 );
 
     // kingdoms
     vec_kingdoms.clear();
@@ -340,13 +342,22 @@ void World::Reset()
 }
 
 void World::generateBattleOnlyMap()
+{
+    generateBattleOnlyMap( Rand::Get( std::numeric_limits<uint32_t>::max() ) );
+}
+
+void World::generateBattleOnlyMap( const uint32_t seed )
 {
     const std::vector<int> terrainTypes{ Maps::Ground::DESERT, Maps::Ground::SNOW, Maps::Ground::SWAMP, Maps::Ground::WASTELAND, Maps::Ground::BEACH,
                                          Maps::Ground::LAVA,   Maps::Ground::DIRT, Maps::Ground::GRASS, Maps::Ground::WATER };
 
     generateUninitializedMap( 2 );
 
-    const int groundType = Rand::Get( terrainTypes );
+    _seed = seed;
+
+    Rand::PCG32 seededGen( seed );
+
+    const int groundType = Rand::GetWithGen( terrainTypes, seededGen );
 
     for ( size_t i = 0; i < vec_tiles.size(); ++i ) {
         vec_tiles[i].setIndex( static_cast<int32_t>( i ) );
@@ -381,6 +392,9 @@ void World::generateUninitializedMap( const int32_t size )
     // The tiles are cleared and resizing their vector also initializes tiles with the default values.
     assert( vec_tiles.empty() );
     vec_tiles.resize( static_cast<size_t>( width ) * height );
+
+    _objectTypeIndex.rebuild( vec_tiles );
+    _fogLayers.reset( width, height );
 }
 
 const Castle * World::getCastleEntrance( const fheroes2::Point & tilePosition ) const
@@ -972,7 +986,7 @@ std::string World::DateString() const
 
 uint32_t World::CountObeliskOnMaps()
 {
-    const size_t res = std::count_if( vec_tiles.begin(), vec_tiles.end(), []( const Maps::Tile & tile ) { return MP2::OBJ_OBELISK == tile.getMainObjectType( false ); } );
+    const size_t res = Maps::GetObjectPositions( MP2::OBJ_OBELISK ).size();
     return res > 0 ? static_cast<uint32_t>( res ) : 6;
 }
 
@@ -1298,8 +1312,40 @@ void World::updatePassabilities()
     }
 }
 
+void World::updatePassabilities( const std::set<int32_t> & tileIndices )
+{
+    // The passability of a tile depends on the tiles to the left, to the right and below it. Also an empty tile becomes a coast
+    // when water appears around it. Therefore, all tiles around the given ones have to be updated as well.
+    std::set<int32_t> tilesToUpdate( tileIndices );
+
+    for ( const int32_t tileIndex : tileIndices ) {
+        for ( const int32_t index : Maps::getAroundIndexes( tileIndex, 1 ) ) {
+            tilesToUpdate.emplace( index );
+        }
+    }
+
+    for ( const int32_t tileIndex : tilesToUpdate ) {
+        Maps::Tile & tile = getTile( tileIndex );
+
+        // Unlike the update of all tiles, the coast type might be outdated here.
+        const MP2::MapObjectType objectType = tile.getMainObjectType();
+        if ( objectType == MP2::OBJ_NONE || objectType == MP2::OBJ_COAST ) {
+            tile.updateObjectType();
+        }
+
+        tile.setInitialPassability();
+    }
+
+    for ( const int32_t tileIndex : tilesToUpdate ) {
+        getTile( tileIndex ).updatePassability();
+    }
+}
+
 void World::PostLoad( const bool setTilePassabilities, const bool updateUidCounterToMaximum )
 {
+    // Tiles are initialized or loaded without updating the object index, so it has to be built from scratch.
+    _objectTypeIndex.rebuild( vec_tiles );
+
     if ( setTilePassabilities ) {
         updatePassabilities();
     }
@@ -1570,8 +1616,15 @@ IStreamBase & operator>>( IStreamBase & stream, World & w )
         stream >> w.width >> w.height;
     }
 
-    stream >> w.vec_tiles >> w.vec_heroes >> w.vec_castles >> w.vec_kingdoms >> w._customRumors >> w.vec_eventsday >> w.map_captureobj >> w.ultimate_artifact >> w.day
-        >> w.week >> w.month >> w.heroIdAsWinCondition >> w.heroIdAsLossCondition;
+    // Tiles are loaded directly bypassing the object index and fog layers.
+    w._objectTypeIndex.invalidate();
+
+    stream >> w.vec_tiles;
+
+    w._fogLayers.rebuild( w.vec_tiles, w.width, w.height );
+
+    stream >> w.vec_heroes >> w.vec_castles >> w.vec_kingdoms >> w._customRumors >> w.vec_eventsday >> w.map_captureobj >> w.ultimate_artifact >> w.day >> w.week
+        >> w.month >> w.heroIdAsWinCondition >> w.heroIdAsLossCondition;
 
     static_assert( LAST_SUPPORTED_FORMAT_VERSION < FORMAT_VERSION_1010_RELEASE, "Remove the logic below." );
     if ( Game::GetVersionOfCurrentSaveFile() < FORMAT_VERSION_1010_RELEASE ) {
@@ -28,6 +28,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -47,6 +48,8 @@
 #include "monster.h"
 #include "pairs.h"
 #include "resource.h"
+#include "world_fog.h"
+#include "world_object_index.h"
 #include "world_pathfinding.h"
 #include "world_regions.h"
 
@@ -209,6 +212,9 @@ public:
 
     // Generate 2x2 map for Battle Only mode.
     void generateBattleOnlyMap();
+    // Generate 2x2 map for Battle Only mode using the given seed. The terrain and the map seed (and therefore the layout
+    // of battlefield obstacles) are fully determined by this seed.
+    void generateBattleOnlyMap( const uint32_t seed );
 
     // Generates a map without initializing tiles.
     // WARNING: call this method only when reading a map from a file
@@ -428,6 +434,28 @@ public:
     std::list<Route::Step> getPath( const Heroes & hero, int targetIndex );
     void resetPathfinder();
 
+    const Maps::ObjectTypeIndex & getObjectTypeIndex() const
+    {
+        return _objectTypeIndex;
+    }
+
+    // Call this method only from Maps::Tile::setMainObjectType().
+    void updateObjectTypeIndex( const int32_t tileIndex, const MP2::MapObjectType oldObjectType, const MP2::MapObjectType newObjectType )
+    {
+        _objectTypeIndex.update( tileIndex, oldObjectType, newObjectType );
+    }
+
+    const Maps::FogLayers & getFogLayers() const
+    {
+        return _fogLayers;
+    }
+
+    // Call this method only from Maps::Tile::ClearFog().
+    void updateFogLayers( const int32_t tileIndex, const PlayerColorsSet colors )
+    {
+        _fogLayers.clearFog( tileIndex, colors );
+    }
+
     void ComputeStaticAnalysis();
 
     uint32_t GetMapSeed() const
@@ -441,6 +469,9 @@ public:
 
     void updatePassabilities();
 
+    // Updates passabilities only of the given tiles and the tiles around them which depend on the given tiles.
+    void updatePassabilities( const std::set<int32_t> & tileIndices );
+
     const std::vector<int32_t> & getAllEyeOfMagiPositions() const
     {
         return _allEyeOfMagi;
@@ -510,6 +541,8 @@ private:
     double _landRoughness{ 1.0 };
     std::vector<MapRegion> _regions;
     PlayerWorldPathfinder _pathfinder;
+    Maps::ObjectTypeIndex _objectTypeIndex;
+    Maps::FogLayers _fogLayers;
 };
 
 OStreamBase & operator<<( OStreamBase & stream, const CapturedObject & obj );
@@ -0,0 +1,160 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2025                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "world_fog.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+#include "maps_tiles.h"
+
+namespace
+{
+    const std::array<PlayerColor, maxNumOfPlayers> layerColors
+        = { PlayerColor::BLUE, PlayerColor::GREEN, PlayerColor::RED, PlayerColor::YELLOW, PlayerColor::ORANGE, PlayerColor::PURPLE };
+}
+
+void Maps::FogLayers::reset( const int32_t width, const int32_t height )
+{
+    assert( width >= 0 && height >= 0 );
+
+    _width = width;
+    _height = height;
+    _wordsPerRow = ( width + 63 ) / 64;
+
+    const size_t layerSize = static_cast<size_t>( _wordsPerRow ) * height;
+
+    // Bits outside the map width are set too, they are always excluded by range masks.
+    for ( std::vector<uint64_t> & layer : _layers ) {
+        layer.assign( layerSize, ~static_cast<uint64_t>( 0 ) );
+    }
+}
+
+void Maps::FogLayers::rebuild( const std::vector<Tile> & tiles, const int32_t width, const int32_t height )
+{
+    if ( width < 0 || height < 0 || tiles.size() != static_cast<size_t>( width ) * height ) {
+        // The map is not loaded properly.
+        reset( 0, 0 );
+        return;
+    }
+
+    reset( width, height );
+
+    for ( int32_t y = 0; y < height; ++y ) {
+        for ( int32_t x = 0; x < width; ++x ) {
+            const Tile & tile = tiles[static_cast<size_t>( y ) * width + x];
+
+            const size_t wordId = static_cast<size_t>( y ) * _wordsPerRow + x / 64;
+            const uint64_t bit = static_cast<uint64_t>( 1 ) << ( x % 64 );
+
+            for ( size_t i = 0; i < layerColors.size(); ++i ) {
+                if ( !tile.isFog( layerColors[i] ) ) {
+                    _layers[i][wordId] &= ~bit;
+                }
+            }
+        }
+    }
+}
+
+void Maps::FogLayers::clearFog( const int32_t tileIndex, const PlayerColorsSet colors )
+{
+    if ( _width <= 0 ) {
+        // Fog layers are not initialized yet.
+        return;
+    }
+
+    assert( tileIndex >= 0 && tileIndex < _width * _height );
+
+    const int32_t x = tileIndex % _width;
+    const size_t wordId = static_cast<size_t>( tileIndex / _width ) * _wordsPerRow + x / 64;
+    const uint64_t bit = static_cast<uint64_t>( 1 ) << ( x % 64 );
+
+    for ( size_t i = 0; i < layerColors.size(); ++i ) {
+        if ( colors & layerColors[i] ) {
+            _layers[i][wordId] &= ~bit;
+        }
+    }
+}
+
+int32_t Maps::FogLayers::countFogTilesInRow( const PlayerColor color, const int32_t y, const int32_t minX, const int32_t maxX ) const
+{
+    int32_t count = 0;
+
+    for ( int32_t wordId = minX / 64; wordId <= maxX / 64; ++wordId ) {
+        count += _countBits( _getFogWord( color, y, wordId ) & _getRangeMask( wordId, minX, maxX ) );
+    }
+
+    return count;
+}
+
+void Maps::FogLayers::getFogRow( const PlayerColorsSet colors, const int32_t y, const int32_t minX, const int32_t maxX, uint8_t * output ) const
+{
+    for ( int32_t wordId = minX / 64; wordId <= maxX / 64; ++wordId ) {
+        const uint64_t word = _getFogWord( colors, y, wordId );
+
+        const int32_t fromX = std::max( minX, wordId * 64 );
+        const int32_t toX = std::min( maxX, wordId * 64 + 63 );
+
+        for ( int32_t x = fromX; x <= toX; ++x ) {
+            *output = static_cast<uint8_t>( ( word >> ( x % 64 ) ) & 1 );
+            ++output;
+        }
+    }
+}
+
+uint64_t Maps::FogLayers::_getFogWord( const PlayerColorsSet colors, const int32_t y, const int32_t wordId ) const
+{
+    assert( y >= 0 && y < _height && wordId >= 0 && wordId < _wordsPerRow );
+
+    if ( ( colors & ~Color::allPlayerColors() ) != 0 ) {
+        // Tiles never have fog for non-player colors.
+        return 0;
+    }
+
+    const size_t offset = static_cast<size_t>( y ) * _wordsPerRow + wordId;
+
+    uint64_t word = ~static_cast<uint64_t>( 0 );
+
+    for ( size_t i = 0; i < layerColors.size(); ++i ) {
+        if ( colors & layerColors[i] ) {
+            word &= _layers[i][offset];
+        }
+    }
+
+    return word;
+}
+
+uint64_t Maps::FogLayers::_getRangeMask( const int32_t wordId, const int32_t minX, const int32_t maxX )
+{
+    assert( minX >= 0 && minX <= maxX );
+
+    const int32_t wordBegin = wordId * 64;
+
+    uint64_t mask = ~static_cast<uint64_t>( 0 );
+    if ( minX > wordBegin ) {
+        mask <<= ( minX - wordBegin );
+    }
+    if ( maxX < wordBegin + 63 ) {
+        mask &= ~static_cast<uint64_t>( 0 ) >> ( 63 - ( maxX - wordBegin ) );
+    }
+
+    return mask;
+}
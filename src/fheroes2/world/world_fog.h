@@ -0,0 +1,102 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2025                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "color.h"
+#include "players.h"
+
+namespace Maps
+{
+    class Tile;
+
+    // Per-player fog of war stored as bit planes: one bit per tile, 64 tiles per word, each map row starts from a new word.
+    // It mirrors the fog state of map tiles and allows to process whole rows of tiles at once.
+    class FogLayers
+    {
+    public:
+        // Sets the fog of all players on all tiles of the map with the given size.
+        void reset( const int32_t width, const int32_t height );
+
+        void rebuild( const std::vector<Tile> & tiles, const int32_t width, const int32_t height );
+
+        // Call this method only from Maps::Tile::ClearFog().
+        void clearFog( const int32_t tileIndex, const PlayerColorsSet colors );
+
+        // Returns the number of tiles within [minX, maxX] range of the given row that are under the fog for the given color.
+        int32_t countFogTilesInRow( const PlayerColor color, const int32_t y, const int32_t minX, const int32_t maxX ) const;
+
+        // Calls 'func( x, isFogForSingleColor, isFogForAllColors )' for every tile within [minX, maxX] range of the given row which is under the fog
+        // either for 'singleColor' or for all of 'colors'. Tiles are processed from left to right.
+        template <typename Func>
+        void forEachFogTileInRow( const PlayerColor singleColor, const PlayerColorsSet colors, const int32_t y, const int32_t minX, const int32_t maxX,
+                                  Func func ) const
+        {
+            for ( int32_t wordId = minX / 64; wordId <= maxX / 64; ++wordId ) {
+                const uint64_t rangeMask = _getRangeMask( wordId, minX, maxX );
+
+                const uint64_t singleColorWord = _getFogWord( singleColor, y, wordId ) & rangeMask;
+                const uint64_t allColorsWord = _getFogWord( colors, y, wordId ) & rangeMask;
+
+                uint64_t word = singleColorWord | allColorsWord;
+                while ( word != 0 ) {
+                    const uint64_t lowestBit = word & ( ~word + 1 );
+                    word ^= lowestBit;
+
+                    func( wordId * 64 + _countBits( lowestBit - 1 ), ( singleColorWord & lowestBit ) != 0, ( allColorsWord & lowestBit ) != 0 );
+                }
+            }
+        }
+
+        // Fills 'output' with 1 for tiles within [minX, maxX] range of the given row that are under the fog for all given colors and with 0 otherwise.
+        void getFogRow( const PlayerColorsSet colors, const int32_t y, const int32_t minX, const int32_t maxX, uint8_t * output ) const;
+
+    private:
+        // Returns the word with bits set for tiles that are under the fog for all given colors.
+        uint64_t _getFogWord( const PlayerColorsSet colors, const int32_t y, const int32_t wordId ) const;
+
+        // Returns the word with bits set for tiles that are under the fog for the given color.
+        uint64_t _getFogWord( const PlayerColor color, const int32_t y, const int32_t wordId ) const
+        {
+            // Unlike a set of colors, no color means no fog.
+            return color == PlayerColor::NONE ? 0 : _getFogWord( static_cast<PlayerColorsSet>( color ), y, wordId );
+        }
+
+        static uint64_t _getRangeMask( const int32_t wordId, const int32_t minX, const int32_t maxX );
+
+        static int32_t _countBits( uint64_t value )
+        {
+            value = value - ( ( value >> 1 ) & 0x5555555555555555ULL );
+            value = ( value & 0x3333333333333333ULL ) + ( ( value >> 2 ) & 0x3333333333333333ULL );
+            value = ( value + ( value >> 4 ) ) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<int32_t>( ( value * 0x0101010101010101ULL ) >> 56 );
+        }
+
+        std::array<std::vector<uint64_t>, maxNumOfPlayers> _layers;
+
+        int32_t _width{ 0 };
+        int32_t _height{ 0 };
+        int32_t _wordsPerRow{ 0 };
+    };
+}
@@ -239,6 +239,7 @@ bool World::LoadMapMP2( const std::string & filename, const bool isOriginalMp2Fi
     fs.seek( MP2::MP2_MAP_INFO_SIZE );
 
     vec_tiles.resize( worldSize );
+    _fogLayers.reset( width, height );
 
     const bool checkPoLObjects = !Settings::Get().isPriceOfLoyaltySupported() && isOriginalMp2File;
 
@@ -724,6 +725,7 @@ bool World::loadResurrectionMap( const std::string & filename )
 
     assert( vec_tiles.empty() );
     vec_tiles.resize( static_cast<size_t>( width ) * height );
+    _fogLayers.reset( width, height );
 
     if ( !Maps::readAllTiles( map ) ) {
         return false;
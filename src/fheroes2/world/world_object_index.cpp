@@ -0,0 +1,121 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2025                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "world_object_index.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+#include "maps_tiles.h"
+#include "mp2.h"
+
+void Maps::ObjectTypeIndex::rebuild( const std::vector<Tile> & tiles )
+{
+    _tileIndexes.clear();
+
+    for ( size_t idx = 0; idx < tiles.size(); ++idx ) {
+        const MP2::MapObjectType objectType = tiles[idx].getMainObjectType();
+        if ( objectType == MP2::OBJ_NONE ) {
+            continue;
+        }
+
+        // Tiles are iterated in ascending order, so the result is sorted
+        _tileIndexes[objectType].push_back( static_cast<int32_t>( idx ) );
+    }
+
+    _isValid = true;
+}
+
+void Maps::ObjectTypeIndex::invalidate()
+{
+    _tileIndexes.clear();
+
+    _isValid = false;
+}
+
+void Maps::ObjectTypeIndex::update( const int32_t tileIndex, const MP2::MapObjectType oldObjectType, const MP2::MapObjectType newObjectType )
+{
+    if ( !_isValid || oldObjectType == newObjectType ) {
+        return;
+    }
+
+    if ( oldObjectType != MP2::OBJ_NONE ) {
+        const auto iter = _tileIndexes.find( oldObjectType );
+        assert( iter != _tileIndexes.end() );
+
+        std::vector<int32_t> & tileIndexes = iter->second;
+
+        const auto tileIter = std::lower_bound( tileIndexes.begin(), tileIndexes.end(), tileIndex );
+        assert( tileIter != tileIndexes.end() && *tileIter == tileIndex );
+
+        tileIndexes.erase( tileIter );
+
+        if ( tileIndexes.empty() ) {
+            _tileIndexes.erase( iter );
+        }
+    }
+
+    if ( newObjectType != MP2::OBJ_NONE ) {
+        std::vector<int32_t> & tileIndexes = _tileIndexes[newObjectType];
+
+        const auto tileIter = std::lower_bound( tileIndexes.begin(), tileIndexes.end(), tileIndex );
+        assert( tileIter == tileIndexes.end() || *tileIter != tileIndex );
+
+        tileIndexes.insert( tileIter, tileIndex );
+    }
+}
+
+const std::vector<int32_t> & Maps::ObjectTypeIndex::getTileIndexes( const MP2::MapObjectType objectType ) const
+{
+    assert( _isValid );
+
+    static const std::vector<int32_t> empty;
+
+    const auto iter = _tileIndexes.find( objectType );
+    if ( iter == _tileIndexes.end() ) {
+        return empty;
+    }
+
+    return iter->second;
+}
+
+void Maps::ObjectTypeIndex::getTileIndexes( const MP2::MapObjectType objectType, const fheroes2::Rect & area, const int32_t mapWidth,
+                                            std::vector<int32_t> & result ) const
+{
+    assert( mapWidth > 0 && area.x >= 0 && area.y >= 0 && area.x + area.width <= mapWidth );
+
+    const std::vector<int32_t> & tileIndexes = getTileIndexes( objectType );
+
+    // Tile indexes are sorted in row-major order, so tiles of each row of the area form a contiguous range
+    for ( int32_t y = area.y; y < area.y + area.height; ++y ) {
+        const int32_t rowBegin = y * mapWidth + area.x;
+        const int32_t rowEnd = rowBegin + area.width;
+
+        const auto beginIter = std::lower_bound( tileIndexes.begin(), tileIndexes.end(), rowBegin );
+        if ( beginIter == tileIndexes.end() ) {
+            break;
+        }
+
+        const auto endIter = std::lower_bound( beginIter, tileIndexes.end(), rowEnd );
+
+        result.insert( result.end(), beginIter, endIter );
+    }
+}
@@ -0,0 +1,68 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2025                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "math_base.h"
+
+namespace MP2
+{
+    enum MapObjectType : uint16_t;
+}
+
+namespace Maps
+{
+    class Tile;
+
+    // Index of map tiles by the type of the main object on them, which allows to find all objects of a certain type without scanning the
+    // whole map. Tiles without objects are not indexed. Tiles with heroes are indexed as MP2::OBJ_HERO, objects under heroes are not indexed.
+    // The index has to be rebuilt after any changes to the map tiles that bypass Tile::setMainObjectType(), such as map or save loading.
+    class ObjectTypeIndex
+    {
+    public:
+        void rebuild( const std::vector<Tile> & tiles );
+
+        // An invalid index is not updated and should not be used until it is rebuilt.
+        void invalidate();
+
+        bool isValid() const
+        {
+            return _isValid;
+        }
+
+        void update( const int32_t tileIndex, const MP2::MapObjectType oldObjectType, const MP2::MapObjectType newObjectType );
+
+        // Returns the indexes of the tiles with the given main object type in ascending order.
+        const std::vector<int32_t> & getTileIndexes( const MP2::MapObjectType objectType ) const;
+
+        // Appends the indexes of the tiles with the given main object type located within the given area of the map with the given width
+        // to the 'result' in ascending order.
+        void getTileIndexes( const MP2::MapObjectType objectType, const fheroes2::Rect & area, const int32_t mapWidth, std::vector<int32_t> & result ) const;
+
+    private:
+        std::map<MP2::MapObjectType, std::vector<int32_t>> _tileIndexes;
+
+        bool _isValid{ false };
+    };
+}
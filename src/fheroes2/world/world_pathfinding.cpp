@@ -34,6 +34,7 @@
 #include "difficulty.h"
 #include "direction.h"
 #include "game.h"
+#include "game_turn_profiler.h"
 #include "ground.h"
 #include "heroes.h"
 #include "kingdom.h"
@@ -48,6 +49,7 @@
 #include "route.h"
 #include "spell.h"
 #include "spell_info.h"
+#include "thread.h"
 #include "tools.h"
 #include "world.h"
 
@@ -78,8 +80,9 @@ namespace
         const MP2::MapObjectType objectType = tile.getMainObjectType();
 
         const auto isTileAccessible = [color, armyStrength, minimalAdvantage, &tile]() {
-            // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations
-            static Army tileArmy;
+            // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations. Every thread
+            // gets its own instance, since AI pathfinder caches can be built concurrently.
+            thread_local Army tileArmy;
             tileArmy.setFromTile( tile );
 
             const PlayerColor tileArmyColor = tileArmy.GetColor();
@@ -297,8 +300,9 @@ namespace
         }
 
         for ( const int32_t monsterIndex : Maps::getMonstersProtectingTile( tileIndex ) ) {
-            // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations
-            static Army tileArmy;
+            // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations. Every thread
+            // gets its own instance, since AI pathfinder caches can be built concurrently.
+            thread_local Army tileArmy;
             tileArmy.setFromTile( world.getTile( monsterIndex ) );
 
             // Tiles guarded by too powerful wandering monsters are considered inaccessible
@@ -569,9 +573,17 @@ void AIWorldPathfinder::reset()
 
     _townGateCastleIndex = -1;
     _townPortalCastleIndexes.clear();
+
+    _cacheSnapshots.clear();
+    _maxCacheSnapshots = defaultMaxCacheSnapshots;
 }
 
 void AIWorldPathfinder::reEvaluateIfNeeded( const Heroes & hero )
+{
+    applyCacheSettings( getCacheSettings( hero ) );
+}
+
+AIWorldPathfinder::CacheSettings AIWorldPathfinder::getCacheSettings( const Heroes & hero ) const
 {
     const bool isSummonBoatSpellAvailable = [this, &hero]() {
         static const Spell summonBoat( Spell::SUMMONBOAT );
@@ -635,37 +647,123 @@ void AIWorldPathfinder::reEvaluateIfNeeded( const Heroes & hero )
         return result;
     }();
 
-    auto currentSettings
-        = std::tie( _pathStart, _color, _remainingMovePoints, _pathfindingSkill, _patrolCenter, _patrolDistance, _maxMovePointsOnLand, _maxMovePointsOnWater,
-                    _remainingSpellPoints, _maxSpellPoints, _dimensionDoorSPCost, _dimensionDoorNumOfUses, _armyStrength, _isOnPatrol, _isArtifactsBagFull,
-                    _isEquippedWithSpellBook, _isSummonBoatSpellAvailable, _isDimensionDoorSpellAvailable, _townGateCastleIndex, _townPortalCastleIndexes );
-    const auto newSettings
-        = std::make_tuple( hero.GetIndex(), hero.GetColor(), hero.GetMovePoints(), static_cast<uint8_t>( hero.GetLevelSkill( Skill::Secondary::PATHFINDING ) ),
+    return std::make_tuple( hero.GetIndex(), hero.GetColor(), hero.GetMovePoints(), static_cast<uint8_t>( hero.GetLevelSkill( Skill::Secondary::PATHFINDING ) ),
                            Maps::GetIndexFromAbsPoint( hero.GetPatrolCenter() ), hero.GetPatrolDistance(), hero.GetMaxMovePoints( false ), hero.GetMaxMovePoints( true ),
                            hero.GetSpellPoints(), hero.GetMaxSpellPoints(), dimensionDoor.spellPoints( &hero ), hero.getDimensionDoorUses(), hero.GetArmy().GetStrength(),
                            hero.Modes( Heroes::PATROL ), hero.IsFullBagArtifacts(), hero.HaveSpellBook(), isSummonBoatSpellAvailable, isDimensionDoorSpellAvailable,
                            townGateCastleIndex, townPortalCastleIndexes );
-
-    if ( currentSettings != newSettings ) {
-        currentSettings = newSettings;
-
-        processWorldMap();
-    }
 }
 
 void AIWorldPathfinder::reEvaluateIfNeeded( const int start, const PlayerColor color, const double armyStrength, const uint8_t skill )
 {
-    auto currentSettings
-        = std::tie( _pathStart, _color, _remainingMovePoints, _pathfindingSkill, _patrolCenter, _patrolDistance, _maxMovePointsOnLand, _maxMovePointsOnWater,
-                    _remainingSpellPoints, _maxSpellPoints, _dimensionDoorSPCost, _dimensionDoorNumOfUses, _armyStrength, _isOnPatrol, _isArtifactsBagFull,
-                    _isEquippedWithSpellBook, _isSummonBoatSpellAvailable, _isDimensionDoorSpellAvailable, _townGateCastleIndex, _townPortalCastleIndexes );
     const auto newSettings
         = std::make_tuple( start, color, 0U, skill, -1, 0U, 0U, 0U, 0U, 0U, 0U, 0U, armyStrength, false, false, false, false, false, -1, std::vector<int32_t>{} );
 
-    if ( currentSettings != newSettings ) {
-        currentSettings = newSettings;
+    applyCacheSettings( newSettings );
+}
 
-        processWorldMap();
+void AIWorldPathfinder::applyCacheSettings( const CacheSettings & settings )
+{
+    auto currentSettings = getCurrentCacheSettings();
+    if ( currentSettings == settings ) {
+        return;
+    }
+
+    const auto snapshotIter
+        = std::find_if( _cacheSnapshots.begin(), _cacheSnapshots.end(), [&settings]( const CacheSnapshot & snapshot ) { return snapshot.settings == settings; } );
+    if ( snapshotIter != _cacheSnapshots.end() ) {
+        // Exchange the current cache with the suitable one and keep the current cache as the most recently used snapshot
+        std::swap( snapshotIter->cache, _cache );
+
+        snapshotIter->settings = currentSettings;
+        currentSettings = settings;
+
+        _cacheSnapshots.splice( _cacheSnapshots.begin(), _cacheSnapshots, snapshotIter );
+
+        return;
+    }
+
+    // There is no valid cache for the current settings if the pathfinder was just reset
+    if ( _pathStart != -1 ) {
+        std::vector<WorldNode> cache;
+
+        if ( _cacheSnapshots.size() < _maxCacheSnapshots ) {
+            cache.resize( _cache.size() );
+        }
+        else {
+            // Reuse the memory of the least recently used snapshot
+            cache = std::move( _cacheSnapshots.back().cache );
+            _cacheSnapshots.pop_back();
+        }
+
+        std::swap( cache, _cache );
+
+        _cacheSnapshots.push_front( { currentSettings, std::move( cache ) } );
+    }
+
+    currentSettings = settings;
+
+    processWorldMap();
+}
+
+void AIWorldPathfinder::precacheHeroes( const std::vector<Heroes *> & heroes )
+{
+    // Settings are evaluated in the calling thread, because it may require access to the hero's kingdom and spells
+    std::vector<CacheSettings> settingsToProcess;
+    settingsToProcess.reserve( heroes.size() );
+
+    {
+        const auto currentSettings = getCurrentCacheSettings();
+
+        for ( const Heroes * hero : heroes ) {
+            assert( hero != nullptr );
+
+            CacheSettings settings = getCacheSettings( *hero );
+            if ( settings == currentSettings ) {
+                continue;
+            }
+
+            if ( std::find( settingsToProcess.begin(), settingsToProcess.end(), settings ) != settingsToProcess.end() ) {
+                continue;
+            }
+
+            const bool isCached = std::any_of( _cacheSnapshots.begin(), _cacheSnapshots.end(),
+                                               [&settings]( const CacheSnapshot & snapshot ) { return snapshot.settings == settings; } );
+            if ( isCached ) {
+                continue;
+            }
+
+            settingsToProcess.push_back( std::move( settings ) );
+        }
+    }
+
+    if ( settingsToProcess.empty() ) {
+        return;
+    }
+
+    std::vector<std::vector<WorldNode>> caches( settingsToProcess.size() );
+
+    // Each cache is built by a separate pathfinder instance that uses the same criteria as this one. These instances only read
+    // the world state, which is not modified while this method is running.
+    const auto buildCache = [this, &settingsToProcess, &caches]( const size_t idx ) {
+        AIWorldPathfinder pathfinder;
+        pathfinder.reset();
+
+        pathfinder._minimalArmyStrengthAdvantage = _minimalArmyStrengthAdvantage;
+        pathfinder._spellPointsReserveRatio = _spellPointsReserveRatio;
+        pathfinder.getCurrentCacheSettings() = settingsToProcess[idx];
+
+        pathfinder.processWorldMap();
+
+        caches[idx] = std::move( pathfinder._cache );
+    };
+
+    MultiThreading::parallelFor( settingsToProcess.size(), buildCache );
+
+    _maxCacheSnapshots = std::max( _maxCacheSnapshots, _cacheSnapshots.size() + settingsToProcess.size() + defaultMaxCacheSnapshots );
+
+    for ( size_t idx = 0; idx < settingsToProcess.size(); ++idx ) {
+        _cacheSnapshots.push_back( { std::move( settingsToProcess[idx] ), std::move( caches[idx] ) } );
     }
 }
 
@@ -693,6 +791,8 @@ bool AIWorldPathfinder::isTileAvailableForWalkThroughForAI( const int tileIndex,
 
 void AIWorldPathfinder::processWorldMap()
 {
+    const TurnProfiler::PhaseTimer phaseTimer( TurnProfiler::Phase::PATHFINDING );
+
     assert( _cache.size() == world.getSize() && Maps::isValidAbsIndex( _pathStart ) );
 
     for ( WorldNode & node : _cache ) {
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <list>
 #include <optional>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -170,6 +171,11 @@ public:
     void reEvaluateIfNeeded( const Heroes & hero );
     void reEvaluateIfNeeded( const int start, const PlayerColor color, const double armyStrength, const uint8_t skill );
 
+    // Builds the pathfinder caches for all the given heroes at once (using multiple threads if possible) and keeps them until
+    // the next reset, so that subsequent re-evaluations for any of these heroes just switch to a ready-made cache instead of
+    // performing a full recalculation.
+    void precacheHeroes( const std::vector<Heroes *> & heroes );
+
     // Finds the most profitable tile for fog discovery. Returns a pair consisting of the tile index (-1 if no suitable tile
     // was found) and a boolean value, which takes the value true if there is fog next to this tile (that is, most likely,
     // through this tile hero can get into some new areas), and false otherwise.
@@ -221,6 +227,31 @@ public:
     void setSpellPointsReserveRatio( const double ratio );
 
 private:
+    // Values of all the parameters (hero or army properties) that affect the contents of the pathfinder cache
+    using CacheSettings = std::tuple<int, PlayerColor, uint32_t, uint8_t, int32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, double, bool,
+                                     bool, bool, bool, bool, int32_t, std::vector<int32_t>>;
+
+    struct CacheSnapshot
+    {
+        CacheSettings settings;
+        std::vector<WorldNode> cache;
+    };
+
+    // Returns references to all the parameters that affect the contents of the pathfinder cache
+    auto getCurrentCacheSettings()
+    {
+        return std::tie( _pathStart, _color, _remainingMovePoints, _pathfindingSkill, _patrolCenter, _patrolDistance, _maxMovePointsOnLand, _maxMovePointsOnWater,
+                         _remainingSpellPoints, _maxSpellPoints, _dimensionDoorSPCost, _dimensionDoorNumOfUses, _armyStrength, _isOnPatrol, _isArtifactsBagFull,
+                         _isEquippedWithSpellBook, _isSummonBoatSpellAvailable, _isDimensionDoorSpellAvailable, _townGateCastleIndex, _townPortalCastleIndexes );
+    }
+
+    // Returns the values of the parameters affecting the contents of the pathfinder cache for the given hero
+    CacheSettings getCacheSettings( const Heroes & hero ) const;
+
+    // Makes the pathfinder cache match the given parameters. If the cache for these parameters was built recently (and the pathfinder
+    // was not reset since then), then it is restored from the snapshot, otherwise it is rebuilt from scratch.
+    void applyCacheSettings( const CacheSettings & settings );
+
     bool isTileAccessibleForAI( const int tileIndex );
     bool isTileAvailableForWalkThroughForAI( const int tileIndex, const bool fromWater );
 
@@ -274,4 +305,15 @@ private:
     // Spell points reservation factor for spells associated with the movement of the hero on the adventure map
     // (such as Dimension Door, Town Gate or Town Portal)
     double _spellPointsReserveRatio{ 0.5 };
+
+    // Caches recently built for other heroes (or armies), most recently used first. The AI often switches between heroes
+    // without changing anything on the map (for example, when it evaluates the targets of each of its heroes and the threat
+    // posed by nearby enemy heroes), and rebuilding the cache from scratch each time is expensive. Since these caches are
+    // only valid until the map changes, they are discarded every time the pathfinder is reset.
+    std::list<CacheSnapshot> _cacheSnapshots;
+
+    // The maximum number of snapshots kept, may be temporarily increased (until the next reset) to fit all the precached heroes
+    size_t _maxCacheSnapshots{ defaultMaxCacheSnapshots };
+
+    static constexpr size_t defaultMaxCacheSnapshots{ 4 };
 };
@@ -0,0 +1,395 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2025                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "agg.h"
+#include "army.h"
+#include "army_troop.h"
+#include "battle.h"
+#include "battle_arena.h"
+#include "battle_army.h"
+#include "bin_info.h"
+#include "color.h"
+#include "logging.h"
+#include "monster.h"
+#include "players.h"
+#include "rand.h"
+#include "settings.h"
+#include "system.h"
+#include "world.h"
+
+namespace
+{
+    // AI-controlled armies without a commander cannot retreat, so the battle is interrupted by the simulator before the AI reaches its
+    // own limit of turns without deaths (see AI::BattlePlanner::isLimitOfTurnsExceeded()). Such a battle is considered a draw.
+    const uint32_t maxBattleTurns{ 50 };
+
+    // The battle takes place on the first tile of the generated Battle Only map
+    const int32_t battleTileIndex{ 0 };
+
+    struct TroopInfo
+    {
+        int monsterId{ Monster::UNKNOWN };
+        uint32_t count{ 0 };
+    };
+
+    struct Matchup
+    {
+        uint32_t seed{ 0 };
+        uint32_t runs{ 0 };
+
+        std::string attackerDescription;
+        std::string defenderDescription;
+
+        std::vector<TroopInfo> attacker;
+        std::vector<TroopInfo> defender;
+    };
+
+    struct BattleOutcome
+    {
+        bool isAttackerWin{ false };
+        bool isDefenderWin{ false };
+
+        uint32_t attackerLosses{ 0 };
+        uint32_t defenderLosses{ 0 };
+        uint32_t turns{ 0 };
+    };
+
+    struct MatchupStatistics
+    {
+        uint32_t attackerWins{ 0 };
+        uint32_t defenderWins{ 0 };
+        uint32_t draws{ 0 };
+
+        uint64_t attackerLosses{ 0 };
+        uint64_t defenderLosses{ 0 };
+        uint64_t turns{ 0 };
+    };
+
+    // Parses a list of troops in the "monster_id:count,monster_id:count,..." format
+    bool parseTroops( const std::string & str, std::vector<TroopInfo> & troops )
+    {
+        std::istringstream stream( str );
+        std::string item;
+
+        while ( std::getline( stream, item, ',' ) ) {
+            const size_t delimiterPos = item.find( ':' );
+            if ( delimiterPos == std::string::npos ) {
+                return false;
+            }
+
+            TroopInfo troop;
+
+            try {
+                troop.monsterId = std::stoi( item.substr( 0, delimiterPos ) );
+                troop.count = static_cast<uint32_t>( std::stoul( item.substr( delimiterPos + 1 ) ) );
+            }
+            catch ( const std::exception & ) {
+                return false;
+            }
+
+            if ( !Monster( troop.monsterId ).isValid() || troop.count == 0 ) {
+                return false;
+            }
+
+            troops.push_back( troop );
+        }
+
+        return !troops.empty() && troops.size() <= Army::maximumTroopCount;
+    }
+
+    // Each non-empty line that does not start with '#' describes one matchup in the "seed runs attacker_troops defender_troops" format
+    bool readMatchups( const std::string & fileName, std::vector<Matchup> & matchups )
+    {
+        std::ifstream inputStream( fileName );
+        if ( !inputStream ) {
+            std::cerr << "Cannot open file " << fileName << std::endl;
+            return false;
+        }
+
+        std::string line;
+        size_t lineNumber = 0;
+
+        while ( std::getline( inputStream, line ) ) {
+            ++lineNumber;
+
+            const size_t firstCharPos = line.find_first_not_of( " \t\r" );
+            if ( firstCharPos == std::string::npos || line[firstCharPos] == '#' ) {
+                continue;
+            }
+
+            std::istringstream lineStream( line );
+            Matchup matchup;
+
+            if ( !( lineStream >> matchup.seed >> matchup.runs >> matchup.attackerDescription >> matchup.defenderDescription ) || matchup.runs == 0
+                 || !parseTroops( matchup.attackerDescription, matchup.attacker ) || !parseTroops( matchup.defenderDescription, matchup.defender ) ) {
+                std::cerr << "Invalid matchup on line " << lineNumber << " of file " << fileName << std::endl;
+                return false;
+            }
+
+            matchups.push_back( std::move( matchup ) );
+        }
+
+        return true;
+    }
+
+    void fillArmy( Army & army, const std::vector<TroopInfo> & troops, const PlayerColor color )
+    {
+        army.SetColor( color );
+
+        for ( size_t i = 0; i < troops.size(); ++i ) {
+            army.GetTroop( i )->Set( Monster( troops[i].monsterId ), troops[i].count );
+        }
+    }
+
+    BattleOutcome simulateBattle( const Matchup & matchup, const uint32_t run )
+    {
+        Army attackingArmy;
+        Army defendingArmy;
+
+        fillArmy( attackingArmy, matchup.attacker, PlayerColor::BLUE );
+        fillArmy( defendingArmy, matchup.defender, PlayerColor::RED );
+
+        Rand::PCG32 randomGenerator( matchup.seed + run );
+        Battle::Arena arena( attackingArmy, defendingArmy, battleTileIndex, false, randomGenerator );
+
+        while ( arena.BattleValid() && arena.GetTurnNumber() < maxBattleTurns ) {
+            arena.Turns();
+        }
+
+        BattleOutcome outcome;
+
+        if ( !arena.BattleValid() ) {
+            const Battle::Result & result = arena.GetResult();
+
+            outcome.isAttackerWin = result.isAttackerWin();
+            outcome.isDefenderWin = result.isDefenderWin();
+        }
+
+        outcome.attackerLosses = arena.getAttackingForce().getTotalNumberOfDeadUnits();
+        outcome.defenderLosses = arena.getDefendingForce().getTotalNumberOfDeadUnits();
+        outcome.turns = arena.GetTurnNumber();
+
+        return outcome;
+    }
+
+    void initializeBattleEnvironment( const std::vector<Matchup> & matchups, const uint32_t mapSeed )
+    {
+        Settings & conf = Settings::Get();
+
+        conf.GetPlayers().Init( PlayerColor::BLUE | PlayerColor::RED );
+
+        Players::SetPlayerControl( PlayerColor::BLUE, CONTROL_AI );
+        Players::SetPlayerControl( PlayerColor::RED, CONTROL_AI );
+
+        world.generateBattleOnlyMap( mapSeed );
+        world.InitKingdoms();
+
+        // Monster animation info is loaded lazily and cached without any synchronization, so it has to be loaded before
+        // any of the worker threads are started
+        std::set<int> monsterIds;
+
+        for ( const Matchup & matchup : matchups ) {
+            for ( const auto * troops : { &matchup.attacker, &matchup.defender } ) {
+                for ( const TroopInfo & troop : *troops ) {
+                    monsterIds.insert( troop.monsterId );
+                }
+            }
+        }
+
+        for ( const int monsterId : monsterIds ) {
+            Bin_Info::GetMonsterInfo( monsterId );
+        }
+    }
+
+    void writeCSV( std::ostream & output, const std::vector<Matchup> & matchups, const std::vector<MatchupStatistics> & statistics )
+    {
+        output << "seed,runs,attacker,defender,attacker_wins,defender_wins,draws,attacker_win_rate,average_attacker_losses,average_defender_losses,average_turns"
+               << std::endl;
+
+        for ( size_t i = 0; i < matchups.size(); ++i ) {
+            const Matchup & matchup = matchups[i];
+            const MatchupStatistics & stats = statistics[i];
+            const double runs = matchup.runs;
+
+            output << matchup.seed << ',' << matchup.runs << ",\"" << matchup.attackerDescription << "\",\"" << matchup.defenderDescription << "\","
+                   << stats.attackerWins << ',' << stats.defenderWins << ',' << stats.draws << ',' << stats.attackerWins / runs << ','
+                   << static_cast<double>( stats.attackerLosses ) / runs << ',' << static_cast<double>( stats.defenderLosses ) / runs << ','
+                   << static_cast<double>( stats.turns ) / runs << std::endl;
+        }
+    }
+
+    void writeJSON( std::ostream & output, const std::vector<Matchup> & matchups, const std::vector<MatchupStatistics> & statistics )
+    {
+        output << '[' << std::endl;
+
+        for ( size_t i = 0; i < matchups.size(); ++i ) {
+            const Matchup & matchup = matchups[i];
+            const MatchupStatistics & stats = statistics[i];
+            const double runs = matchup.runs;
+
+            output << "  { \"seed\": " << matchup.seed << ", \"runs\": " << matchup.runs << ", \"attacker\": \"" << matchup.attackerDescription
+                   << "\", \"defender\": \"" << matchup.defenderDescription << "\", \"attacker_wins\": " << stats.attackerWins
+                   << ", \"defender_wins\": " << stats.defenderWins << ", \"draws\": " << stats.draws << ", \"attacker_win_rate\": " << stats.attackerWins / runs
+                   << ", \"average_attacker_losses\": " << static_cast<double>( stats.attackerLosses ) / runs
+                   << ", \"average_defender_losses\": " << static_cast<double>( stats.defenderLosses ) / runs
+                   << ", \"average_turns\": " << static_cast<double>( stats.turns ) / runs << " }" << ( i + 1 < matchups.size() ? "," : "" ) << std::endl;
+        }
+
+        output << ']' << std::endl;
+    }
+}
+
+int main( int argc, char ** argv )
+{
+    if ( argc < 2 ) {
+        const std::string toolName = System::GetFileName( argv[0] );
+
+        std::cerr << toolName << " runs AI vs AI battles without any UI and reports their statistics." << std::endl
+                  << "Syntax: " << toolName << " [-json] [-threads N] [-mapseed N] [-debug N] matchups.txt" << std::endl
+                  << "Each line of the matchups file has the following format: seed runs attacker_troops defender_troops," << std::endl
+                  << "where troops are listed as monster_id:count pairs separated by commas, for example: 1 100 1:50,3:10 5:40" << std::endl
+                  << "The -debug option sets the level of logging in the same way as the debug setting of the game." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    bool isJSONOutput = false;
+    uint32_t threadCount = std::max( std::thread::hardware_concurrency(), 1U );
+    uint32_t mapSeed = 0;
+    int debugLevel = 0;
+    std::string matchupsFileName;
+
+    for ( int i = 1; i < argc; ++i ) {
+        const std::string arg( argv[i] );
+
+        try {
+            if ( arg == "-json" ) {
+                isJSONOutput = true;
+            }
+            else if ( arg == "-threads" && i + 1 < argc ) {
+                threadCount = std::max( static_cast<uint32_t>( std::stoul( argv[++i] ) ), 1U );
+            }
+            else if ( arg == "-mapseed" && i + 1 < argc ) {
+                mapSeed = static_cast<uint32_t>( std::stoul( argv[++i] ) );
+            }
+            else if ( arg == "-debug" && i + 1 < argc ) {
+                debugLevel = std::stoi( argv[++i] );
+            }
+            else {
+                matchupsFileName = arg;
+            }
+        }
+        catch ( const std::exception & ) {
+            std::cerr << "Invalid value of the " << arg << " parameter" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<Matchup> matchups;
+    if ( !readMatchups( matchupsFileName, matchups ) ) {
+        return EXIT_FAILURE;
+    }
+
+    try {
+        Logging::InitLog();
+
+        Settings::setDebug( debugLevel );
+
+        Settings::Get().SetProgramPath( argv[0] );
+
+        const AGG::AGGInitializer aggInitializer;
+
+        initializeBattleEnvironment( matchups, mapSeed );
+
+        // Every single battle is an independent task, its outcome depends only on the matchup seed and the run number
+        std::vector<std::pair<size_t, uint32_t>> tasks;
+        for ( size_t i = 0; i < matchups.size(); ++i ) {
+            for ( uint32_t run = 0; run < matchups[i].runs; ++run ) {
+                tasks.emplace_back( i, run );
+            }
+        }
+
+        std::vector<BattleOutcome> outcomes( tasks.size() );
+        std::atomic<size_t> nextTaskId{ 0 };
+
+        std::vector<std::thread> workers;
+        workers.reserve( threadCount );
+
+        for ( uint32_t i = 0; i < threadCount; ++i ) {
+            workers.emplace_back( [&tasks, &outcomes, &matchups, &nextTaskId]() {
+                for ( size_t taskId = nextTaskId++; taskId < tasks.size(); taskId = nextTaskId++ ) {
+                    outcomes[taskId] = simulateBattle( matchups[tasks[taskId].first], tasks[taskId].second );
+                }
+            } );
+        }
+
+        for ( std::thread & worker : workers ) {
+            worker.join();
+        }
+
+        std::vector<MatchupStatistics> statistics( matchups.size() );
+
+        for ( size_t taskId = 0; taskId < tasks.size(); ++taskId ) {
+            const BattleOutcome & outcome = outcomes[taskId];
+            MatchupStatistics & stats = statistics[tasks[taskId].first];
+
+            if ( outcome.isAttackerWin ) {
+                ++stats.attackerWins;
+            }
+            else if ( outcome.isDefenderWin ) {
+                ++stats.defenderWins;
+            }
+            else {
+                ++stats.draws;
+            }
+
+            stats.attackerLosses += outcome.attackerLosses;
+            stats.defenderLosses += outcome.defenderLosses;
+            stats.turns += outcome.turns;
+        }
+
+        if ( isJSONOutput ) {
+            writeJSON( std::cout, matchups, statistics );
+        }
+        else {
+            writeCSV( std::cout, matchups, statistics );
+        }
+    }
+    catch ( const std::exception & ex ) {
+        std::cerr << "Exception '" << ex.what() << "' occurred during the simulation." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}